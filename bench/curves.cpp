@@ -0,0 +1,95 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+long long get_nsec_time() {
+    auto timepoint = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timepoint.time_since_epoch()).count();
+}
+
+template<typename CurveGroup>
+bool generator_comb_benchmark(const std::string &name) {
+    using group_value_type = typename CurveGroup::value_type;
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+    using comb_type = curves::detail::fixed_base_comb<group_value_type, scalar_field_type>;
+
+    constexpr const std::size_t iterations = 100;
+    const group_value_type g = group_value_type::one();
+    const comb_type &comb = curves::detail::generator_comb<group_value_type, scalar_field_type>();
+
+    std::vector<scalar_value_type> scalars;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        scalars.emplace_back(random_element<scalar_field_type>());
+    }
+
+    // columns_count doublings and columns_count + 1 additions of entries selected in constant time
+    std::vector<group_value_type> comb_results;
+    long long start_time = get_nsec_time();
+    for (const scalar_value_type &s : scalars) {
+        comb_results.emplace_back(comb.mul(s));
+    }
+    const long long comb_time = get_nsec_time() - start_time;
+
+    std::vector<group_value_type> glv_results;
+    start_time = get_nsec_time();
+    for (const scalar_value_type &s : scalars) {
+        glv_results.emplace_back(curves::detail::glv_scalar_mul(g, s));
+    }
+    const long long glv_time = get_nsec_time() - start_time;
+
+    std::cout << name << " generator multiplication: comb of " << comb_type::teeth_count << " teeth ("
+              << comb_type::columns_count << " doublings, " << comb_type::columns_count + 1 << " additions) "
+              << comb_time / iterations << " ns, GLV " << glv_time / iterations << " ns" << std::endl;
+    return comb_results == glv_results;
+}
+
+int main() {
+    bool ok = true;
+
+    ok &= generator_comb_benchmark<curves::bls12<381>::g1_type<>>("bls12_381 G1");
+    ok &= generator_comb_benchmark<curves::alt_bn128<254>::g1_type<>>("alt_bn128 G1");
+    ok &= generator_comb_benchmark<curves::secp_k1<256>::g1_type<>>("secp256k1 G1");
+
+    if (!ok) {
+        std::cerr << "Benchmarked results do not match" << std::endl;
+    }
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
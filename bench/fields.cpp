@@ -0,0 +1,154 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include <nil/crypto3/algebra/fields/fp2.hpp>
+#include <nil/crypto3/algebra/fields/fp6_3over2.hpp>
+#include <nil/crypto3/algebra/fields/fp12_2over3over2.hpp>
+
+#include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/alt_bn128/base_field.hpp>
+#include <nil/crypto3/algebra/fields/secp/secp_k1/base_field.hpp>
+
+using namespace nil::crypto3::algebra;
+
+long long get_nsec_time() {
+    auto timepoint = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timepoint.time_since_epoch()).count();
+}
+
+template<typename FieldType>
+bool fixed_montgomery_benchmark(const std::string &name) {
+    using value_type = typename FieldType::value_type;
+
+    constexpr const std::size_t iterations = 100000;
+    const value_type y = value_type(3).inversed();
+
+    // the generic product of the modular_adaptor numbers the fixed multiplication replaces
+    value_type generic(7);
+    long long start_time = get_nsec_time();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        generic = value_type(generic.data * y.data);
+    }
+    const long long generic_time = get_nsec_time() - start_time;
+
+    value_type fixed(7);
+    start_time = get_nsec_time();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        fixed *= y;
+    }
+    const long long fixed_time = get_nsec_time() - start_time;
+
+    std::cout << name << " multiplication: generic " << generic_time / iterations << " ns, fixed Montgomery "
+              << fixed_time / iterations << " ns" << std::endl;
+    return fixed == generic;
+}
+
+template<typename FieldType>
+bool lazy_reduction_benchmark(const std::string &name) {
+    using fp_type = typename FieldType::value_type;
+    using fp2_type = typename fields::fp2<FieldType>::value_type;
+    using fp6_type = typename fields::fp6_3over2<FieldType>::value_type;
+    using fp12_type = typename fields::fp12_2over3over2<FieldType>::value_type;
+
+    // Karatsuba products reducing every Fp product, which is what the lazy paths replace
+    const auto eager_mul2 = [](const fp2_type &A, const fp2_type &B) {
+        const fp_type A0B0 = A.data[0] * B.data[0], A1B1 = A.data[1] * B.data[1];
+        return fp2_type(A0B0 + fp2_type::non_residue * A1B1,
+                        (A.data[0] + A.data[1]) * (B.data[0] + B.data[1]) - A0B0 - A1B1);
+    };
+    const auto eager_mul6 = [&eager_mul2](const fp6_type &A, const fp6_type &B) {
+        const fp2_type A0B0 = eager_mul2(A.data[0], B.data[0]), A1B1 = eager_mul2(A.data[1], B.data[1]),
+                       A2B2 = eager_mul2(A.data[2], B.data[2]);
+        return fp6_type(
+            A0B0 + eager_mul2(fp6_type::non_residue,
+                              eager_mul2(A.data[1] + A.data[2], B.data[1] + B.data[2]) - A1B1 - A2B2),
+            eager_mul2(A.data[0] + A.data[1], B.data[0] + B.data[1]) - A0B0 - A1B1 +
+                eager_mul2(fp6_type::non_residue, A2B2),
+            eager_mul2(A.data[0] + A.data[2], B.data[0] + B.data[2]) - A0B0 + A1B1 - A2B2);
+    };
+    const auto eager_mul12 = [&eager_mul6](const fp12_type &A, const fp12_type &B) {
+        const fp6_type A0B0 = eager_mul6(A.data[0], B.data[0]), A1B1 = eager_mul6(A.data[1], B.data[1]);
+        return fp12_type(A0B0 + A.mul_by_non_residue(A1B1),
+                         eager_mul6(A.data[0] + A.data[1], B.data[0] + B.data[1]) - A0B0 - A1B1);
+    };
+
+    std::array<fp_type, 12> y;
+    fp_type a(fp_type(3).inversed());
+    for (std::size_t j = 0; j < 12; ++j) {
+        y[j] = a;
+        a = a.squared() + fp_type(j);
+    }
+    const fp2_type y2(y[0], y[1]);
+    const fp6_type y6(y2, fp2_type(y[2], y[3]), fp2_type(y[4], y[5]));
+    const fp12_type y12(y6, fp6_type(fp2_type(y[6], y[7]), fp2_type(y[8], y[9]), fp2_type(y[10], y[11])));
+
+    constexpr const std::size_t iterations = 10000;
+    const auto time_chain = [](auto x, const auto &y, const auto &mul) {
+        const long long start_time = get_nsec_time();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            x = mul(x, y);
+        }
+        return std::make_pair(get_nsec_time() - start_time, x);
+    };
+    const auto lazy_mul = [](const auto &A, const auto &B) { return A * B; };
+
+    const auto lazy2 = time_chain(fp2_type::one(), y2, lazy_mul), eager2 = time_chain(fp2_type::one(), y2, eager_mul2);
+    const auto lazy6 = time_chain(fp6_type::one(), y6, lazy_mul), eager6 = time_chain(fp6_type::one(), y6, eager_mul6);
+    const auto lazy12 = time_chain(fp12_type::one(), y12, lazy_mul),
+               eager12 = time_chain(fp12_type::one(), y12, eager_mul12);
+
+    std::cout << name << " Fp2 multiplication: eager " << eager2.first / iterations << " ns, lazy "
+              << lazy2.first / iterations << " ns" << std::endl;
+    std::cout << name << " Fp6 multiplication: eager " << eager6.first / iterations << " ns, lazy "
+              << lazy6.first / iterations << " ns" << std::endl;
+    std::cout << name << " Fp12 multiplication: eager " << eager12.first / iterations << " ns, lazy "
+              << lazy12.first / iterations << " ns" << std::endl;
+    return lazy2.second == eager2.second && lazy6.second == eager6.second && lazy12.second == eager12.second;
+}
+
+int main() {
+    bool ok = true;
+
+    ok &= fixed_montgomery_benchmark<fields::bls12_fq<381>>("bls12_381 Fq");
+    ok &= fixed_montgomery_benchmark<fields::bls12_fr<381>>("bls12_381 Fr");
+    ok &= fixed_montgomery_benchmark<fields::alt_bn128_fq<254>>("alt_bn128 Fq");
+    ok &= fixed_montgomery_benchmark<fields::secp_k1_fq<256>>("secp256k1 Fq");
+
+    ok &= lazy_reduction_benchmark<fields::bls12_fq<381>>("bls12_381");
+    ok &= lazy_reduction_benchmark<fields::alt_bn128_fq<254>>("alt_bn128");
+
+    if (!ok) {
+        std::cerr << "Benchmarked results do not match" << std::endl;
+    }
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,226 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_BATCH_VERIFY_PAIRINGS_HPP
+#define CRYPTO3_ALGEBRA_BATCH_VERIFY_PAIRINGS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/random/random_device.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/parallelization.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /**
+             * @brief Pairing equation e(a, b) = e(c, d).
+             */
+            template<typename PairingCurveType>
+            struct pairing_equation {
+                typedef typename PairingCurveType::template g1_type<>::value_type g1_value_type;
+                typedef typename PairingCurveType::template g2_type<>::value_type g2_value_type;
+
+                g1_value_type a;
+                g2_value_type b;
+                g1_value_type c;
+                g2_value_type d;
+            };
+
+            namespace detail {
+                /**
+                 * Folds pairing equations with random scalars r_i into the single check
+                 * prod e(r_i * a_i, b_i) * e(-r_i * c_i, d_i) = 1. The r_i have batch_scalar_bits bits,
+                 * so a batch holding a false equation passes with probability at most 2^-batch_scalar_bits,
+                 * provided the points lie in the prime order subgroups. The r_i are multiplied in as 128-bit
+                 * integers rather than scalar field elements, which halves the length of these
+                 * multiplications. Subranges of the equations are checked with the same r_i, which is
+                 * enough to find the false equations by bisection.
+                 */
+                template<typename PairingCurveType, typename PairingPolicy>
+                class batch_pairing_verifier {
+                    typedef typename PairingCurveType::scalar_field_type scalar_field_type;
+                    typedef multiprecision::uint128_t batch_scalar_type;
+                    typedef typename PairingCurveType::gt_type::value_type gt_value_type;
+
+                    typedef std::pair<typename PairingPolicy::g1_precomputed_type,
+                                      typename PairingPolicy::g2_precomputed_type>
+                        precomputed_pair_type;
+
+                public:
+                    constexpr static const std::size_t batch_scalar_bits =
+                        std::min<std::size_t>(128, scalar_field_type::modulus_bits - 1);
+
+                    template<typename InputRange, typename RNG, typename Executor>
+                    batch_pairing_verifier(const InputRange &equations, RNG &rng, const std::size_t chunks_count,
+                                           Executor &&executor) :
+                        equations_count(std::distance(std::begin(equations), std::end(equations))),
+                        prec_pairs(2 * equations_count) {
+
+                        boost::random::uniform_int_distribution<batch_scalar_type> d(
+                            1, ~batch_scalar_type(0) >> (128 - batch_scalar_bits));
+                        std::vector<batch_scalar_type> scalars;
+                        scalars.reserve(equations_count);
+                        for (std::size_t i = 0; i < equations_count; ++i) {
+                            scalars.emplace_back(d(rng));
+                        }
+
+                        auto first = std::begin(equations);
+                        detail::parallel_for_chunks(
+                            std::forward<Executor>(executor), equations_count, chunks_count,
+                            [this, first, &scalars](std::size_t begin, std::size_t end) {
+                                auto it = std::next(first, begin);
+                                for (std::size_t i = begin; i < end; ++i, ++it) {
+                                    const pairing_equation<PairingCurveType> &equation = *it;
+                                    prec_pairs[2 * i] = precomputed_pair_type(
+                                        PairingPolicy::precompute_g1::process(scalars[i] * equation.a),
+                                        PairingPolicy::precompute_g2::process(equation.b));
+                                    prec_pairs[2 * i + 1] = precomputed_pair_type(
+                                        PairingPolicy::precompute_g1::process(-(scalars[i] * equation.c)),
+                                        PairingPolicy::precompute_g2::process(equation.d));
+                                }
+                            });
+                    }
+
+                    std::size_t size() const {
+                        return equations_count;
+                    }
+
+                    /// Checks the equations with indices in [first, last) in one final exponentiation
+                    template<typename Executor>
+                    bool verify(const std::size_t first, const std::size_t last, const std::size_t chunks_count,
+                                Executor &&executor) const {
+                        std::vector<gt_value_type> partial_results = detail::parallel_chunks(
+                            std::forward<Executor>(executor), last - first, chunks_count,
+                            [this, first](std::size_t begin, std::size_t end) {
+                                return PairingPolicy::multi_miller_loop::process(
+                                    boost::make_iterator_range(prec_pairs.begin() + 2 * (first + begin),
+                                                               prec_pairs.begin() + 2 * (first + end)));
+                            });
+
+                        const gt_value_type f = detail::tree_reduce(
+                            std::move(partial_results), [](const gt_value_type &a, const gt_value_type &b) {
+                                return a * b;
+                            });
+                        return PairingPolicy::final_exponentiation::process(f) == gt_value_type::one();
+                    }
+
+                    /**
+                     * Appends the indices of the false equations in [first, last) to failed. A range known
+                     * to hold a false equation is split without being checked as a whole.
+                     */
+                    template<typename Executor>
+                    void find_failures(const std::size_t first, const std::size_t last, const bool known_to_fail,
+                                       std::vector<std::size_t> &failed, const std::size_t chunks_count,
+                                       Executor &executor) const {
+                        if (first == last || (!known_to_fail && verify(first, last, chunks_count, executor))) {
+                            return;
+                        }
+                        if (last - first == 1) {
+                            failed.push_back(first);
+                            return;
+                        }
+
+                        const std::size_t middle = first + (last - first) / 2;
+                        const bool first_half_fails = !verify(first, middle, chunks_count, executor);
+                        if (first_half_fails) {
+                            find_failures(first, middle, true, failed, chunks_count, executor);
+                        }
+                        // the whole range fails, so the second half does too when the first one passes
+                        find_failures(middle, last, !first_half_fails, failed, chunks_count, executor);
+                    }
+
+                private:
+                    std::size_t equations_count;
+                    std::vector<precomputed_pair_type> prec_pairs;
+                };
+            }    // namespace detail
+
+            /**
+             * @brief Checks a range of pairing_equation at the cost of one multi Miller loop and one final
+             * exponentiation. A false equation is missed with probability at most 2^-128.
+             * The precomputations and the Miller loops are split into chunks_count slices run through
+             * the executor.
+             *
+             * All the points have to lie in the prime order subgroups of G1 and G2. Points from outside,
+             * e.g. deserialized from an untrusted source, are to be checked first with
+             * batch_is_in_prime_subgroup, otherwise a false equation may pass with a much higher
+             * probability.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>,
+                     typename InputRange, typename RNG, typename Executor>
+            bool batch_verify_pairings(const InputRange &equations, RNG &&rng, const std::size_t chunks_count,
+                                       Executor &&executor) {
+                const detail::batch_pairing_verifier<PairingCurveType, PairingPolicy> verifier(
+                    equations, rng, chunks_count, executor);
+                return verifier.verify(0, verifier.size(), chunks_count, executor);
+            }
+
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>,
+                     typename InputRange, typename RNG = boost::random_device>
+            bool batch_verify_pairings(const InputRange &equations, RNG &&rng = boost::random_device()) {
+                return batch_verify_pairings<PairingCurveType, PairingPolicy>(equations, rng, default_chunks_count(),
+                                                                              async_executor());
+            }
+
+            /**
+             * @brief Indices of the false equations of a range of pairing_equation, in increasing order.
+             * The equations are checked as one batch, failing batches are bisected. The points have to
+             * lie in the prime order subgroups, see batch_verify_pairings.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>,
+                     typename InputRange, typename RNG, typename Executor>
+            std::vector<std::size_t> batch_find_failed_pairings(const InputRange &equations, RNG &&rng,
+                                                                const std::size_t chunks_count,
+                                                                Executor &&executor) {
+                const detail::batch_pairing_verifier<PairingCurveType, PairingPolicy> verifier(
+                    equations, rng, chunks_count, executor);
+
+                std::vector<std::size_t> failed;
+                verifier.find_failures(0, verifier.size(), false, failed, chunks_count, executor);
+                return failed;
+            }
+
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>,
+                     typename InputRange, typename RNG = boost::random_device>
+            std::vector<std::size_t> batch_find_failed_pairings(const InputRange &equations,
+                                                                RNG &&rng = boost::random_device()) {
+                return batch_find_failed_pairings<PairingCurveType, PairingPolicy>(
+                    equations, rng, default_chunks_count(), async_executor());
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_BATCH_VERIFY_PAIRINGS_HPP
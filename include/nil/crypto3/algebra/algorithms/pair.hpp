@@ -101,6 +101,17 @@ namespace nil {
                 return PairingPolicy::double_miller_loop::process(prec_P1, prec_Q1, prec_P2, prec_Q2);
             }
 
+            /**
+             * @brief Product of the Miller loops of a range of (g1_precomputed_type, g2_precomputed_type) pairs.
+             * A single final_exponentiation of the result gives the product of the pairings.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>,
+                     typename InputRange>
+            typename PairingCurveType::gt_type::value_type multi_miller_loop(const InputRange &prec_pairs) {
+
+                return PairingPolicy::multi_miller_loop::process(prec_pairs);
+            }
+
             template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
             typename PairingCurveType::gt_type::value_type
                 final_exponentiation(const typename PairingCurveType::gt_type::value_type &elt) {
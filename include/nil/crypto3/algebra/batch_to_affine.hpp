@@ -0,0 +1,121 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_BATCH_TO_AFFINE_HPP
+#define CRYPTO3_ALGEBRA_BATCH_TO_AFFINE_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/fields/detail/batch_inversion.hpp>
+#include <nil/crypto3/algebra/parallelization.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                template<typename GroupValueType, typename = void>
+                struct affine_element {
+                    typedef decltype(std::declval<const GroupValueType &>().to_affine()) type;
+                };
+
+                template<typename GroupValueType>
+                struct affine_element<GroupValueType,
+                                      typename std::enable_if<std::is_same<typename GroupValueType::coordinates,
+                                                                           curves::coordinates::affine>::value>::type> {
+                    typedef GroupValueType type;
+                };
+            }    // namespace detail
+
+            /**
+             * @brief Writes the affine forms of the points of [first, last) to out, sharing one field
+             * inversion per slice among all of them.
+             *
+             * Every coordinate system provides affine_denominator() and to_affine(denominator_inversed),
+             * the denominators are inverted with fields::batch_inverse. The points at infinity give the
+             * affine zero. The input is split into chunks_count slices processed through the executor,
+             * both iterators have to be random access.
+             */
+            template<typename InputIterator, typename OutputIterator, typename Executor>
+            OutputIterator batch_to_affine(InputIterator first, InputIterator last, OutputIterator out,
+                                           const std::size_t chunks_count, Executor &&executor) {
+                typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+
+                if constexpr (std::is_same<typename value_type::coordinates, curves::coordinates::affine>::value) {
+                    return std::copy(first, last, out);
+                } else {
+                    typedef typename value_type::field_type::value_type field_value_type;
+
+                    const std::size_t size = std::distance(first, last);
+                    std::vector<field_value_type> denominators(size), inverses(size);
+
+                    detail::parallel_for_chunks(
+                        std::forward<Executor>(executor), size, chunks_count,
+                        [first, out, &denominators, &inverses](std::size_t begin, std::size_t end) {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                denominators[i] = first[i].affine_denominator();
+                            }
+
+                            fields::batch_inverse(denominators.begin() + begin, denominators.begin() + end,
+                                                  inverses.begin() + begin);
+
+                            for (std::size_t i = begin; i < end; ++i) {
+                                out[i] = first[i].to_affine(inverses[i]);
+                            }
+                        });
+
+                    return out + size;
+                }
+            }
+
+            template<typename InputIterator, typename OutputIterator>
+            OutputIterator batch_to_affine(InputIterator first, InputIterator last, OutputIterator out) {
+                return batch_to_affine(first, last, out, 1, sequential_executor());
+            }
+
+            /// @return affine forms of the points of the range
+            template<typename InputRange, typename Executor>
+            std::vector<typename detail::affine_element<typename InputRange::value_type>::type>
+                batch_to_affine(const InputRange &points, const std::size_t chunks_count, Executor &&executor) {
+                std::vector<typename detail::affine_element<typename InputRange::value_type>::type> result(
+                    std::distance(points.begin(), points.end()));
+                batch_to_affine(points.begin(), points.end(), result.begin(), chunks_count,
+                                std::forward<Executor>(executor));
+                return result;
+            }
+
+            template<typename InputRange>
+            std::vector<typename detail::affine_element<typename InputRange::value_type>::type>
+                batch_to_affine(const InputRange &points) {
+                return batch_to_affine(points, 1, sequential_executor());
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_BATCH_TO_AFFINE_HPP
@@ -31,9 +31,6 @@
 #include <nil/crypto3/algebra/curves/detail/alt_bn128/g1.hpp>
 #include <nil/crypto3/algebra/curves/detail/alt_bn128/g2.hpp>
 
-//#include <nil/crypto3/algebra/pairing/alt_bn128.hpp>
-//#include <nil/crypto3/algebra/pairing/detail/alt_bn128/functions.hpp>
-
 namespace nil {
     namespace crypto3 {
         namespace algebra {
@@ -61,9 +58,6 @@ namespace nil {
                              typename Form = forms::short_weierstrass>
                     using g2_type = typename detail::alt_bn128_g2<Version, Form, Coordinates>;
 
-                    // typedef typename pairing::pairing_policy<alt_bn128<Version>,
-                    //    pairing::detail::alt_bn128_pairing_functions<Version>> pairing_policy;
-
                     typedef typename policy_type::gt_field_type gt_type;
                 };
 
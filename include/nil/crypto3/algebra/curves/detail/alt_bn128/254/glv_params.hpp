@@ -0,0 +1,97 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_ALT_BN128_254_GLV_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_ALT_BN128_254_GLV_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/alt_bn128/254/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /**
+                     * @brief GLV constants of alt_bn128 G1: beta^3 = 1 in Fq, lambda^3 = 1 in Fr, phi(P) = lambda * P.
+                     *
+                     * Short basis of the lattice {(a, b) : a + b * lambda = 0 mod r}:
+                     *  a1 = 9931322734385697763, b1 = -147946756881789319000765030803803410728,
+                     *  a2 = 147946756881789319010696353538189108491, b2 = 9931322734385697763.
+                     */
+                    template<>
+                    struct glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>> {
+                        using base_field_type = typename alt_bn128_g1_params<254, forms::short_weierstrass>::field_type;
+                        using scalar_field_type =
+                            typename alt_bn128_g1_params<254, forms::short_weierstrass>::scalar_field_type;
+                        using extended_integral_type = typename scalar_field_type::extended_integral_type;
+
+                        constexpr static const typename base_field_type::value_type beta =
+                            typename base_field_type::value_type(
+                                0x59E26BCEA0D48BACD4F263F1ACDB5C4F5763473177FFFFFE_cppui191);
+                        constexpr static const typename scalar_field_type::value_type lambda =
+                            typename scalar_field_type::value_type(
+                                0xB3C4D79D41A917585BFC41088D8DAAA78B17EA66B99C90DD_cppui192);
+
+                        constexpr static const std::size_t shift = 508;
+                        constexpr static const extended_integral_type g1 =
+                            0x2D91D232EC7E0B3D76EB9C714773A6EF28FA7D32D2FAFBA642E3FF027EFCCD68A96CE4AECE61F034_cppui318;
+                        constexpr static const extended_integral_type g2 =
+                            0x24CCEF014A773D2CF7A7BD9D4391EB18DA5E38CFB5EAA26D9869375169B9BDFFA7ABF2E6FC85F00FAD073CED5F11AEEB_cppui382;
+                        constexpr static const typename scalar_field_type::value_type minus_b1 =
+                            typename scalar_field_type::value_type(
+                                0x6F4D8248EEB859FC8211BBEB7D4F1128_cppui127);
+                        constexpr static const typename scalar_field_type::value_type minus_b2 =
+                            typename scalar_field_type::value_type(
+                                0x30644E72E131A029B85045B68181585D2833E84879B97090BA0ED02B5B2DEC1E_cppui254);
+                    };
+
+                    constexpr typename glv_params<
+                        alt_bn128_g1_params<254, forms::short_weierstrass>>::base_field_type::value_type const
+                        glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::beta;
+                    constexpr typename glv_params<
+                        alt_bn128_g1_params<254, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::lambda;
+                    constexpr std::size_t const
+                        glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::shift;
+                    constexpr typename glv_params<
+                        alt_bn128_g1_params<254, forms::short_weierstrass>>::extended_integral_type const
+                        glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::g1;
+                    constexpr typename glv_params<
+                        alt_bn128_g1_params<254, forms::short_weierstrass>>::extended_integral_type const
+                        glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::g2;
+                    constexpr typename glv_params<
+                        alt_bn128_g1_params<254, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::minus_b1;
+                    constexpr typename glv_params<
+                        alt_bn128_g1_params<254, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::minus_b2;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_ALT_BN128_254_GLV_PARAMS_HPP
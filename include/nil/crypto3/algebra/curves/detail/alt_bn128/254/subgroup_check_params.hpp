@@ -0,0 +1,88 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_ALT_BN128_254_SUBGROUP_CHECK_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_ALT_BN128_254_SUBGROUP_CHECK_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/alt_bn128/254/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /// The curve has prime order, so every point of it is in G1
+                    template<>
+                    struct subgroup_check_params<alt_bn128_g1_params<254, forms::short_weierstrass>> {
+                        constexpr static const subgroup_check_type type = subgroup_check_type::cofactor_one;
+                    };
+
+                    /// alt_bn128 G2: psi(P) == [z]P, z = 6u^2, u = 0x44E992B44A6909F1
+                    template<>
+                    struct subgroup_check_params<alt_bn128_g2_params<254, forms::short_weierstrass>> {
+                        using field_type = typename alt_bn128_g2_params<254, forms::short_weierstrass>::field_type;
+
+                        constexpr static const subgroup_check_type type = subgroup_check_type::psi;
+                        /// smallest prime factor of the cofactor is 10069
+                        constexpr static const std::size_t cofactor_min_prime_bits = 13;
+                        /// |z|
+                        constexpr static const typename alt_bn128_types<254>::integral_type z =
+                            0x6F4D8248EEB859FBF83E9682E87CFD46_cppui127;
+                        constexpr static const bool z_is_negative = false;
+                        constexpr static const typename field_type::value_type psi_x =
+                            typename field_type::value_type(
+                                0x2FB347984F7911F74C0BEC3CF559B143B78CC310C2C3330C99E39557176F553D_cppui254,
+                                0x16C9E55061EBAE204BA4CC8BD75A079432AE2A1D0B7C9DCE1665D51C640FCBA2_cppui253);
+                        constexpr static const typename field_type::value_type psi_y =
+                            typename field_type::value_type(
+                                0x63CF305489AF5DCDC5EC698B6E2F9B9DBAAE0EDA9C95998DC54014671A0135A_cppui251,
+                                0x7C03CBCAC41049A0704B5A7EC796F2B21807DC98FA25BD282D37F632623B0E3_cppui251);
+                    };
+
+                    constexpr subgroup_check_type const
+                        subgroup_check_params<alt_bn128_g1_params<254, forms::short_weierstrass>>::type;
+                    constexpr subgroup_check_type const
+                        subgroup_check_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::type;
+                    constexpr std::size_t const
+                        subgroup_check_params<
+                            alt_bn128_g2_params<254, forms::short_weierstrass>>::cofactor_min_prime_bits;
+                    constexpr typename alt_bn128_types<254>::integral_type const
+                        subgroup_check_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::z;
+                    constexpr bool const
+                        subgroup_check_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::z_is_negative;
+                    constexpr typename subgroup_check_params<
+                        alt_bn128_g2_params<254, forms::short_weierstrass>>::field_type::value_type const
+                        subgroup_check_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::psi_x;
+                    constexpr typename subgroup_check_params<
+                        alt_bn128_g2_params<254, forms::short_weierstrass>>::field_type::value_type const
+                        subgroup_check_params<alt_bn128_g2_params<254, forms::short_weierstrass>>::psi_y;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_ALT_BN128_254_SUBGROUP_CHECK_PARAMS_HPP
@@ -0,0 +1,96 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_BLS12_377_GLV_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_BLS12_377_GLV_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/bls12/377/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /**
+                     * @brief GLV constants of BLS12-377 G1: beta^3 = 1 in Fq, lambda^3 = 1 in Fr, phi(P) = lambda * P.
+                     *
+                     * Short basis of the lattice {(a, b) : a + b * lambda = 0 mod r}:
+                     *  a1 = 1, b1 = 91893752504881257701523279626832445441,
+                     *  a2 = 91893752504881257701523279626832445440, b2 = -1.
+                     */
+                    template<>
+                    struct glv_params<bls12_g1_params<377, forms::short_weierstrass>> {
+                        using base_field_type = typename bls12_g1_params<377, forms::short_weierstrass>::field_type;
+                        using scalar_field_type =
+                            typename bls12_g1_params<377, forms::short_weierstrass>::scalar_field_type;
+                        using extended_integral_type = typename scalar_field_type::extended_integral_type;
+
+                        constexpr static const typename base_field_type::value_type beta =
+                            typename base_field_type::value_type(
+                                0x9B3AF05DD14F6EC619AAF7D34594AABC5ED1347970DEC00452217CC900000008508C00000000001_cppui316);
+                        constexpr static const typename scalar_field_type::value_type lambda =
+                            typename scalar_field_type::value_type(
+                                0x452217CC900000010A11800000000000_cppui127);
+
+                        constexpr static const std::size_t shift = 506;
+                        constexpr static const extended_integral_type g1 =
+                            0x36D9491EC40B2C9EE4E51E49FAA80548FD0A180B8D69E258F5204C21151E79EA_cppui254;
+                        constexpr static const extended_integral_type g2 =
+                            0xECFDEAA5A7F4DC581FDCBB4CABE4060B0CD9BF21DBC971AD5731680EDEE0833DA7C0B77CCEAFE51F99C8BF17A2F7E05_cppui380;
+                        constexpr static const typename scalar_field_type::value_type minus_b1 =
+                            typename scalar_field_type::value_type(
+                                0x12AB655E9A2CA55660B44D1E5C37B00114885F32400000000000000000000000_cppui253);
+                        constexpr static const typename scalar_field_type::value_type minus_b2 =
+                            scalar_field_type::value_type::one();
+                    };
+
+                    constexpr typename glv_params<
+                        bls12_g1_params<377, forms::short_weierstrass>>::base_field_type::value_type const
+                        glv_params<bls12_g1_params<377, forms::short_weierstrass>>::beta;
+                    constexpr typename glv_params<
+                        bls12_g1_params<377, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<bls12_g1_params<377, forms::short_weierstrass>>::lambda;
+                    constexpr std::size_t const
+                        glv_params<bls12_g1_params<377, forms::short_weierstrass>>::shift;
+                    constexpr typename glv_params<
+                        bls12_g1_params<377, forms::short_weierstrass>>::extended_integral_type const
+                        glv_params<bls12_g1_params<377, forms::short_weierstrass>>::g1;
+                    constexpr typename glv_params<
+                        bls12_g1_params<377, forms::short_weierstrass>>::extended_integral_type const
+                        glv_params<bls12_g1_params<377, forms::short_weierstrass>>::g2;
+                    constexpr typename glv_params<
+                        bls12_g1_params<377, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<bls12_g1_params<377, forms::short_weierstrass>>::minus_b1;
+                    constexpr typename glv_params<
+                        bls12_g1_params<377, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<bls12_g1_params<377, forms::short_weierstrass>>::minus_b2;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_BLS12_377_GLV_PARAMS_HPP
@@ -0,0 +1,104 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_BLS12_377_SUBGROUP_CHECK_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_BLS12_377_SUBGROUP_CHECK_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/bls12/377/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /// BLS12-377 G1: sigma(P) == [-u^2]P, omega a cube root of unity with eigenvalue -u^2 on G1
+                    template<>
+                    struct subgroup_check_params<bls12_g1_params<377, forms::short_weierstrass>> {
+                        using field_type = typename bls12_g1_params<377, forms::short_weierstrass>::field_type;
+
+                        constexpr static const subgroup_check_type type = subgroup_check_type::sigma;
+                        /// smallest prime factor of the cofactor is 2
+                        constexpr static const std::size_t cofactor_min_prime_bits = 1;
+                        /// |u|
+                        constexpr static const typename bls12_types<377>::integral_type u =
+                            0x8508C00000000001_cppui64;
+                        constexpr static const typename field_type::value_type omega =
+                            typename field_type::value_type(
+                                0x1AE3A4617C510EABC8756BA8F8C524EB8882A75CC9BC8E359064EE822FB5BFFD1E945779FFFFFFFFFFFFFFFFFFFFFFF_cppui377);
+                    };
+
+                    /// BLS12-377 G2: psi(P) == [z]P, z = u = 0x8508C00000000001
+                    template<>
+                    struct subgroup_check_params<bls12_g2_params<377, forms::short_weierstrass>> {
+                        using field_type = typename bls12_g2_params<377, forms::short_weierstrass>::field_type;
+
+                        constexpr static const subgroup_check_type type = subgroup_check_type::psi;
+                        /// smallest prime factor of the cofactor is above 2^17
+                        constexpr static const std::size_t cofactor_min_prime_bits = 17;
+                        /// |z|
+                        constexpr static const typename bls12_types<377>::integral_type z =
+                            0x8508C00000000001_cppui64;
+                        constexpr static const bool z_is_negative = false;
+                        constexpr static const typename field_type::value_type psi_x =
+                            typename field_type::value_type(
+                                0x9B3AF05DD14F6EC619AAF7D34594AABC5ED1347970DEC00452217CC900000008508C00000000002_cppui316,
+                                0x00_cppui1);
+                        constexpr static const typename field_type::value_type psi_y =
+                            typename field_type::value_type(
+                                0x1680A40796537CAC0C534DB1A79BEB1400398F50AD1DEC1BCE649CF436B0F6299588459BFF27D8E6E76D5ECF1391C63_cppui377,
+                                0x00_cppui1);
+                    };
+
+                    constexpr subgroup_check_type const
+                        subgroup_check_params<bls12_g1_params<377, forms::short_weierstrass>>::type;
+                    constexpr std::size_t const
+                        subgroup_check_params<bls12_g1_params<377, forms::short_weierstrass>>::cofactor_min_prime_bits;
+                    constexpr typename bls12_types<377>::integral_type const
+                        subgroup_check_params<bls12_g1_params<377, forms::short_weierstrass>>::u;
+                    constexpr typename subgroup_check_params<
+                        bls12_g1_params<377, forms::short_weierstrass>>::field_type::value_type const
+                        subgroup_check_params<bls12_g1_params<377, forms::short_weierstrass>>::omega;
+                    constexpr subgroup_check_type const
+                        subgroup_check_params<bls12_g2_params<377, forms::short_weierstrass>>::type;
+                    constexpr std::size_t const
+                        subgroup_check_params<bls12_g2_params<377, forms::short_weierstrass>>::cofactor_min_prime_bits;
+                    constexpr typename bls12_types<377>::integral_type const
+                        subgroup_check_params<bls12_g2_params<377, forms::short_weierstrass>>::z;
+                    constexpr bool const
+                        subgroup_check_params<bls12_g2_params<377, forms::short_weierstrass>>::z_is_negative;
+                    constexpr typename subgroup_check_params<
+                        bls12_g2_params<377, forms::short_weierstrass>>::field_type::value_type const
+                        subgroup_check_params<bls12_g2_params<377, forms::short_weierstrass>>::psi_x;
+                    constexpr typename subgroup_check_params<
+                        bls12_g2_params<377, forms::short_weierstrass>>::field_type::value_type const
+                        subgroup_check_params<bls12_g2_params<377, forms::short_weierstrass>>::psi_y;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_BLS12_377_SUBGROUP_CHECK_PARAMS_HPP
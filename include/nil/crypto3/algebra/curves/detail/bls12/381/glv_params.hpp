@@ -0,0 +1,96 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_BLS12_381_GLV_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_BLS12_381_GLV_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/bls12/381/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /**
+                     * @brief GLV constants of BLS12-381 G1: beta^3 = 1 in Fq, lambda^3 = 1 in Fr, phi(P) = lambda * P.
+                     *
+                     * Short basis of the lattice {(a, b) : a + b * lambda = 0 mod r}:
+                     *  a1 = 1, b1 = 228988810152649578064853576960394133504,
+                     *  a2 = 228988810152649578064853576960394133503, b2 = -1.
+                     */
+                    template<>
+                    struct glv_params<bls12_g1_params<381, forms::short_weierstrass>> {
+                        using base_field_type = typename bls12_g1_params<381, forms::short_weierstrass>::field_type;
+                        using scalar_field_type =
+                            typename bls12_g1_params<381, forms::short_weierstrass>::scalar_field_type;
+                        using extended_integral_type = typename scalar_field_type::extended_integral_type;
+
+                        constexpr static const typename base_field_type::value_type beta =
+                            typename base_field_type::value_type(
+                                0x1A0111EA397FE699EC02408663D4DE85AA0D857D89759AD4897D29650FB85F9B409427EB4F49FFFD8BFD00000000AAAC_cppui381);
+                        constexpr static const typename scalar_field_type::value_type lambda =
+                            typename scalar_field_type::value_type(
+                                0xAC45A4010001A40200000000FFFFFFFF_cppui128);
+
+                        constexpr static const std::size_t shift = 510;
+                        constexpr static const extended_integral_type g1 =
+                            0x8D54253B7FB78DDF0E2D772DC1F823B4D9410FAD2F92EB5C509CDE80830358E5_cppui256;
+                        constexpr static const extended_integral_type g2 =
+                            0x5F1AFB3C7807EAB758FDB948BDB3FB8C0E27D269C9A2FDE8F69793E3625B1CB67F29F0979CCD3E1D98773212F1350F1A_cppui383;
+                        constexpr static const typename scalar_field_type::value_type minus_b1 =
+                            typename scalar_field_type::value_type(
+                                0x73EDA753299D7D483339D80809A1D804A7780001FFFCB7FCFFFFFFFE00000001_cppui255);
+                        constexpr static const typename scalar_field_type::value_type minus_b2 =
+                            scalar_field_type::value_type::one();
+                    };
+
+                    constexpr typename glv_params<
+                        bls12_g1_params<381, forms::short_weierstrass>>::base_field_type::value_type const
+                        glv_params<bls12_g1_params<381, forms::short_weierstrass>>::beta;
+                    constexpr typename glv_params<
+                        bls12_g1_params<381, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<bls12_g1_params<381, forms::short_weierstrass>>::lambda;
+                    constexpr std::size_t const
+                        glv_params<bls12_g1_params<381, forms::short_weierstrass>>::shift;
+                    constexpr typename glv_params<
+                        bls12_g1_params<381, forms::short_weierstrass>>::extended_integral_type const
+                        glv_params<bls12_g1_params<381, forms::short_weierstrass>>::g1;
+                    constexpr typename glv_params<
+                        bls12_g1_params<381, forms::short_weierstrass>>::extended_integral_type const
+                        glv_params<bls12_g1_params<381, forms::short_weierstrass>>::g2;
+                    constexpr typename glv_params<
+                        bls12_g1_params<381, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<bls12_g1_params<381, forms::short_weierstrass>>::minus_b1;
+                    constexpr typename glv_params<
+                        bls12_g1_params<381, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<bls12_g1_params<381, forms::short_weierstrass>>::minus_b2;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_BLS12_381_GLV_PARAMS_HPP
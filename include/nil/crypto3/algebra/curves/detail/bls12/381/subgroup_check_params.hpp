@@ -0,0 +1,104 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_BLS12_381_SUBGROUP_CHECK_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_BLS12_381_SUBGROUP_CHECK_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/bls12/381/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /// BLS12-381 G1: sigma(P) == [-u^2]P, omega a cube root of unity with eigenvalue -u^2 on G1
+                    template<>
+                    struct subgroup_check_params<bls12_g1_params<381, forms::short_weierstrass>> {
+                        using field_type = typename bls12_g1_params<381, forms::short_weierstrass>::field_type;
+
+                        constexpr static const subgroup_check_type type = subgroup_check_type::sigma;
+                        /// smallest prime factor of the cofactor is 3
+                        constexpr static const std::size_t cofactor_min_prime_bits = 1;
+                        /// |u|
+                        constexpr static const typename bls12_types<381>::integral_type u =
+                            0xD201000000010000_cppui64;
+                        constexpr static const typename field_type::value_type omega =
+                            typename field_type::value_type(
+                                0x5F19672FDF76CE51BA69C6076A0F77EADDB3A93BE6F89688DE17D813620A00022E01FFFFFFFEFFFE_cppui319);
+                    };
+
+                    /// BLS12-381 G2: psi(P) == [z]P, z = u = -0xD201000000010000
+                    template<>
+                    struct subgroup_check_params<bls12_g2_params<381, forms::short_weierstrass>> {
+                        using field_type = typename bls12_g2_params<381, forms::short_weierstrass>::field_type;
+
+                        constexpr static const subgroup_check_type type = subgroup_check_type::psi;
+                        /// smallest prime factor of the cofactor is 13
+                        constexpr static const std::size_t cofactor_min_prime_bits = 3;
+                        /// |z|
+                        constexpr static const typename bls12_types<381>::integral_type z =
+                            0xD201000000010000_cppui64;
+                        constexpr static const bool z_is_negative = true;
+                        constexpr static const typename field_type::value_type psi_x =
+                            typename field_type::value_type(
+                                0x00_cppui1,
+                                0x1A0111EA397FE699EC02408663D4DE85AA0D857D89759AD4897D29650FB85F9B409427EB4F49FFFD8BFD00000000AAAD_cppui381);
+                        constexpr static const typename field_type::value_type psi_y =
+                            typename field_type::value_type(
+                                0x135203E60180A68EE2E9C448D77A2CD91C3DEDD930B1CF60EF396489F61EB45E304466CF3E67FA0AF1EE7B04121BDEA2_cppui381,
+                                0x6AF0E0437FF400B6831E36D6BD17FFE48395DABC2D3435E77F76E17009241C5EE67992F72EC05F4C81084FBEDE3CC09_cppui379);
+                    };
+
+                    constexpr subgroup_check_type const
+                        subgroup_check_params<bls12_g1_params<381, forms::short_weierstrass>>::type;
+                    constexpr std::size_t const
+                        subgroup_check_params<bls12_g1_params<381, forms::short_weierstrass>>::cofactor_min_prime_bits;
+                    constexpr typename bls12_types<381>::integral_type const
+                        subgroup_check_params<bls12_g1_params<381, forms::short_weierstrass>>::u;
+                    constexpr typename subgroup_check_params<
+                        bls12_g1_params<381, forms::short_weierstrass>>::field_type::value_type const
+                        subgroup_check_params<bls12_g1_params<381, forms::short_weierstrass>>::omega;
+                    constexpr subgroup_check_type const
+                        subgroup_check_params<bls12_g2_params<381, forms::short_weierstrass>>::type;
+                    constexpr std::size_t const
+                        subgroup_check_params<bls12_g2_params<381, forms::short_weierstrass>>::cofactor_min_prime_bits;
+                    constexpr typename bls12_types<381>::integral_type const
+                        subgroup_check_params<bls12_g2_params<381, forms::short_weierstrass>>::z;
+                    constexpr bool const
+                        subgroup_check_params<bls12_g2_params<381, forms::short_weierstrass>>::z_is_negative;
+                    constexpr typename subgroup_check_params<
+                        bls12_g2_params<381, forms::short_weierstrass>>::field_type::value_type const
+                        subgroup_check_params<bls12_g2_params<381, forms::short_weierstrass>>::psi_x;
+                    constexpr typename subgroup_check_params<
+                        bls12_g2_params<381, forms::short_weierstrass>>::field_type::value_type const
+                        subgroup_check_params<bls12_g2_params<381, forms::short_weierstrass>>::psi_y;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_BLS12_381_SUBGROUP_CHECK_PARAMS_HPP
@@ -28,7 +28,11 @@
 #define CRYPTO3_ALGEBRA_CURVES_BLS12_G1_HPP
 
 #include <nil/crypto3/algebra/curves/detail/bls12/377/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/377/subgroup_check_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/377/glv_params.hpp>
 #include <nil/crypto3/algebra/curves/detail/bls12/381/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/381/subgroup_check_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/381/glv_params.hpp>
 
 #include <nil/crypto3/algebra/curves/forms.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/jacobian_with_a4_0/element_g1.hpp>
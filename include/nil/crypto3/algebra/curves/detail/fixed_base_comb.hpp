@@ -0,0 +1,252 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_FIXED_BASE_COMB_HPP
+#define CRYPTO3_ALGEBRA_CURVES_FIXED_BASE_COMB_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /// True if FieldValueType provides conditional_assign, which masks limbs instead of branching
+                    template<typename FieldValueType, typename = void>
+                    struct has_conditional_assign : std::false_type { };
+
+                    template<typename FieldValueType>
+                    struct has_conditional_assign<
+                        FieldValueType,
+                        std::void_t<decltype(std::declval<FieldValueType &>().conditional_assign(
+                            std::declval<const FieldValueType &>(), true))>> : std::true_type { };
+
+                    /// True if GroupValueType keeps the extended coordinate T along with X, Y and Z
+                    template<typename GroupValueType, typename = void>
+                    struct has_t_coordinate : std::false_type { };
+
+                    template<typename GroupValueType>
+                    struct has_t_coordinate<GroupValueType, std::void_t<decltype(std::declval<GroupValueType &>().T)>>
+                        : std::true_type { };
+
+                    /// dst = flag ? src : dst, coordinate by coordinate without a branch on flag
+                    template<typename GroupValueType>
+                    void conditional_assign(GroupValueType &dst, const GroupValueType &src, bool flag) {
+                        typedef typename GroupValueType::field_type::value_type field_value_type;
+
+                        static_assert(has_conditional_assign<field_value_type>::value,
+                                      "The comb selects its entries in constant time only over fields with a "
+                                      "branch-free conditional_assign");
+
+                        dst.X.conditional_assign(src.X, flag);
+                        dst.Y.conditional_assign(src.Y, flag);
+                        dst.Z.conditional_assign(src.Z, flag);
+                        if constexpr (has_t_coordinate<GroupValueType>::value) {
+                            dst.T.conditional_assign(src.T, flag);
+                        }
+                    }
+
+                    /// True if the comb of GroupValueType keeps its entries with Z = 1 and adds them with mixed_add
+                    template<typename GroupValueType, typename = void>
+                    struct fixed_base_comb_is_special : std::false_type { };
+
+                    template<typename GroupValueType>
+                    struct fixed_base_comb_is_special<
+                        GroupValueType,
+                        std::void_t<decltype(GroupValueType::batch_to_special_all_non_zeros(
+                            std::declval<std::vector<GroupValueType> &>()))>> : std::true_type { };
+
+                    /**
+                     * @brief Fixed-base comb of Lim and Lee with signed digits.
+                     *
+                     * The scalar bits are dealt out to teeth_count teeth of columns_count bits each, bit i + d * j
+                     * going to the column i and the tooth j. The columns are recoded so that every one of them
+                     * has the lowest tooth set, the digit of a column being its teeth pattern and a sign. The
+                     * table thus only keeps the points g + e_1 * 2^d * g + ... + e_{w-1} * 2^{(w-1)d} * g,
+                     * and a multiplication takes columns_count doublings and columns_count + 1 additions,
+                     * whatever the scalar is.
+                     *
+                     * The recoding needs an odd scalar: an even one is made odd by setting its lowest bit and
+                     * g is subtracted in the end, which is correct for a base of any order. Each digit is looked
+                     * up by reading the whole table and masking the limbs of the coordinates, so that neither the
+                     * access pattern, the branches nor the count of group operations depend on the scalar.
+                     */
+                    template<typename GroupValueType, typename ScalarFieldType>
+                    class fixed_base_comb {
+                    public:
+                        typedef GroupValueType value_type;
+                        typedef ScalarFieldType scalar_field_type;
+                        typedef typename scalar_field_type::value_type scalar_field_value_type;
+                        typedef typename scalar_field_type::integral_type integral_type;
+
+                        constexpr static const std::size_t teeth_count = 5;
+                        constexpr static const std::size_t scalar_bits = scalar_field_type::modulus_bits;
+                        constexpr static const std::size_t columns_count =
+                            (scalar_bits + teeth_count - 1) / teeth_count;
+                        constexpr static const std::size_t table_size = std::size_t(1) << (teeth_count - 1);
+
+                    private:
+                        static_assert(teeth_count < 8, "A digit keeps the teeth pattern and the sign in one byte");
+
+                        typedef std::array<std::uint8_t, columns_count + 1> digits_type;
+
+                        constexpr static const std::uint8_t negative_digit = 0x80;
+
+                        std::vector<value_type> table;
+
+                        /// Columns of an odd scalar recoded to digits with the lowest tooth set
+                        static digits_type recode(const integral_type &scalar) {
+                            digits_type digits = {};
+                            for (std::size_t i = 0; i < columns_count; ++i) {
+                                for (std::size_t j = 0; j < teeth_count; ++j) {
+                                    const std::size_t bit = i + columns_count * j;
+                                    if (bit < scalar_bits && multiprecision::bit_test(scalar, bit)) {
+                                        digits[i] |= std::uint8_t(1) << j;
+                                    }
+                                }
+                            }
+
+                            // An even column is replaced by itself plus the previous one, which is negated in
+                            // turn; teeth are added independently, carrying into the next column.
+                            std::uint8_t carry = 0;
+                            for (std::size_t i = 1; i <= columns_count; ++i) {
+                                const std::uint8_t next_carry = digits[i] & carry;
+                                digits[i] ^= carry;
+                                carry = next_carry;
+
+                                const std::uint8_t adjust = 1 - (digits[i] & 1);
+                                carry |= digits[i] & (digits[i - 1] * adjust);
+                                digits[i] ^= digits[i - 1] * adjust;
+                                digits[i - 1] |= adjust << 7;
+                            }
+
+                            return digits;
+                        }
+
+                        value_type select(std::uint8_t digit) const {
+                            const std::size_t index = (digit & ~negative_digit) >> 1;
+
+                            value_type result = table[0];
+                            for (std::size_t i = 1; i < table_size; ++i) {
+                                conditional_assign(result, table[i], i == index);
+                            }
+                            conditional_assign(result, -result, (digit & negative_digit) != 0);
+
+                            return result;
+                        }
+
+                        static value_type add(const value_type &acc, const value_type &entry) {
+                            if constexpr (fixed_base_comb_is_special<value_type>::value) {
+                                return acc.mixed_add(entry);
+                            } else {
+                                return acc + entry;
+                            }
+                        }
+
+                    public:
+                        explicit fixed_base_comb(const value_type &base) : table(table_size) {
+                            table[0] = base;
+
+                            value_type tooth_base = base;
+                            for (std::size_t j = 1; j < teeth_count; ++j) {
+                                for (std::size_t i = 0; i < columns_count; ++i) {
+                                    tooth_base = tooth_base.doubled();
+                                }
+
+                                const std::size_t half = std::size_t(1) << (j - 1);
+                                for (std::size_t i = 0; i < half; ++i) {
+                                    table[half + i] = table[i] + tooth_base;
+                                }
+                            }
+
+                            if constexpr (fixed_base_comb_is_special<value_type>::value) {
+                                value_type::batch_to_special_all_non_zeros(table);
+                            }
+                        }
+
+                        value_type mul(const scalar_field_value_type &scalar) const {
+                            if (scalar.is_zero()) {
+                                return value_type::zero();
+                            }
+
+                            integral_type odd_scalar = scalar.data.template convert_to<integral_type>();
+                            const bool is_even = !multiprecision::bit_test(odd_scalar, 0);
+                            multiprecision::bit_set(odd_scalar, 0);
+
+                            const digits_type digits = recode(odd_scalar);
+
+                            value_type result = select(digits[columns_count]);
+                            for (std::size_t i = columns_count; i-- > 0;) {
+                                result = add(result.doubled(), select(digits[i]));
+                            }
+
+                            const value_type corrected = add(result, -table[0]);
+                            conditional_assign(result, corrected, is_even);
+
+                            return result;
+                        }
+                    };
+
+                    /// True if multiplication of the generator of GroupValueType by FieldValueType goes through
+                    /// the comb, i.e. for short Weierstrass and twisted Edwards groups over their scalar field
+                    template<typename GroupValueType, typename FieldValueType, typename = void>
+                    struct has_generator_comb : std::false_type { };
+
+                    template<typename GroupValueType, typename FieldValueType>
+                    struct has_generator_comb<
+                        GroupValueType, FieldValueType,
+                        std::void_t<typename GroupValueType::group_type::curve_type::scalar_field_type>>
+                        : std::integral_constant<
+                              bool,
+                              std::is_same<typename FieldValueType::field_type,
+                                           typename GroupValueType::group_type::curve_type::scalar_field_type>::value &&
+                                  (std::is_same<typename GroupValueType::form, forms::short_weierstrass>::value ||
+                                   std::is_same<typename GroupValueType::form, forms::twisted_edwards>::value) &&
+                                  !std::is_same<typename GroupValueType::coordinates, coordinates::affine>::value> { };
+
+                    /// Comb of GroupValueType::one(), built on first use
+                    template<typename GroupValueType, typename ScalarFieldType>
+                    const fixed_base_comb<GroupValueType, ScalarFieldType> &generator_comb() {
+                        static const fixed_base_comb<GroupValueType, ScalarFieldType> comb(GroupValueType::one());
+                        return comb;
+                    }
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_FIXED_BASE_COMB_HPP
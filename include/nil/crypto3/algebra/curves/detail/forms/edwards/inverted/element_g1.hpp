@@ -179,6 +179,34 @@ namespace nil {
                             return result_type(Z / X, Z / Y);    //  x=Z/X, y=Z/Y
                         }
 
+                        /** @brief
+                         *
+                         * @return the value whose inverse gives the affine coordinates, see batch_to_affine
+                         */
+                        constexpr field_value_type affine_denominator() const {
+                            return X * Y;
+                        }
+
+                        /** @brief
+                         *
+                         * @return the corresponding affine point, given the inverse of affine_denominator()
+                         */
+                        constexpr curve_element<typename params_type::affine_params, form,
+                                                typename curves::coordinates::affine>
+                            to_affine(const field_value_type &denominator_inversed) const {
+
+                            using result_type = curve_element<typename params_type::affine_params, form,
+                                                              typename curves::coordinates::affine>;
+
+                            if (is_zero()) {
+                                return result_type::zero();
+                            }
+
+                            //  x=Z/X=Z*Y/(X*Y), y=Z/Y=Z*X/(X*Y)
+                            const field_value_type Z_denominator_inversed = Z * denominator_inversed;
+                            return result_type(Y * Z_denominator_inversed, X * Z_denominator_inversed);
+                        }
+
                         /*************************  Arithmetic operations  ***********************************/
 
                         constexpr curve_element operator=(const curve_element &other) {
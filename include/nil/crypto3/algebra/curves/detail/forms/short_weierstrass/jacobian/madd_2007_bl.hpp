@@ -34,7 +34,8 @@ namespace nil {
 
                     /** @brief A struct representing element addition from the group G1 of short Weierstrass curve
                      *  for jacobian coordinates representation.
-                     *  NOTE: does not handle O and pts of order 2,4
+                     *  NOTE: second has to be affine (Z2 = 1) and neither point may be O, mixed_add checks
+                     *  for O before. second = first is delegated to doubling and second = -first gives O.
                      *  http://www.hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#addition-madd-2007-bl
                      */
 
@@ -53,10 +54,17 @@ namespace nil {
                             const field_value_type U2 = second.X * Z1Z1;                  // X2*Z1Z1
                             const field_value_type S2 = second.Y * first.Z * Z1Z1;        // S2 = Y2 * Z1 * Z1Z1
                             const field_value_type H = U2 - (first.X);                    // H = U2-X1
+                            const field_value_type S2_minus_Y1 = S2 - (first.Y);
+
+                            if (H.is_zero()) {
+                                // the formula degenerates for second = first and second = -first
+                                return S2_minus_Y1.is_zero() ? first.doubled() : ElementType::zero();
+                            }
+
                             const field_value_type HH = H.squared();                      // HH = H^2
                             const field_value_type I = HH.doubled().doubled();            // I = 4*HH
                             const field_value_type J = H * I;                             // J = H*I
-                            const field_value_type r = (S2 - (first.Y)).doubled();        // r = 2*(S2-Y1)
+                            const field_value_type r = S2_minus_Y1.doubled();             // r = 2*(S2-Y1)
                             const field_value_type V = first.X * I;                       // V = X1*I
                             const field_value_type X3 = r.squared() - J - V.doubled();    // X3 = r^2-J-2*V
                             const field_value_type Y3 =
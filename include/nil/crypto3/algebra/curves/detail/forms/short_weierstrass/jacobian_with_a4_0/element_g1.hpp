@@ -27,7 +27,9 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_JACOBIAN_WITH_A4_0_HPP
 #define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_JACOBIAN_WITH_A4_0_HPP
 
+#include <nil/crypto3/algebra/batch_to_affine.hpp>
 #include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
 #include <nil/crypto3/algebra/curves/forms.hpp>
 
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
@@ -190,6 +192,15 @@ namespace nil {
                             }
                         }
 
+                        /** @brief
+                         *
+                         * @return true if element from the curve lies in the prime order subgroup,
+                         * with the fastest test known for the group, see subgroup_check_type
+                         */
+                        bool is_in_prime_subgroup() const {
+                            return check_prime_subgroup_membership(*this);
+                        }
+
                         /*************************  Reducing operations  ***********************************/
 
                         /** @brief
@@ -209,6 +220,32 @@ namespace nil {
                             return result_type(X / Z.squared(), Y / (Z * Z.squared()));    //  x=X/Z^2, y=Y/Z^3
                         }
 
+                        /** @brief
+                         *
+                         * @return the value whose inverse gives the affine coordinates, see batch_to_affine
+                         */
+                        constexpr field_value_type affine_denominator() const {
+                            return Z;
+                        }
+
+                        /** @brief
+                         *
+                         * @return the corresponding affine point, given the inverse of affine_denominator()
+                         */
+                        constexpr curve_element<params_type, form, typename curves::coordinates::affine>
+                            to_affine(const field_value_type &denominator_inversed) const {
+
+                            using result_type = curve_element<params_type, form, typename curves::coordinates::affine>;
+
+                            if (is_zero()) {
+                                return result_type::zero();
+                            }
+
+                            const field_value_type Z_inversed_squared = denominator_inversed.squared();
+                            return result_type(X * Z_inversed_squared,
+                                               Y * Z_inversed_squared * denominator_inversed);    //  x=X/Z^2, y=Y/Z^3
+                        }
+
                         /** @brief
                          *
                          * @return return the corresponding element from jacobian_with_a4_0 coordinates to
@@ -228,6 +265,20 @@ namespace nil {
                                                Z);    // X = X/Z, Y = Y/Z^2, Z = Z
                         }
 
+                        /** @brief Brings every point of the vector to the special form Z = 1,
+                         *  sharing a single field inversion among all of them, see batch_to_affine.
+                         *  All the points must be non-zero.
+                         */
+                        static void batch_to_special_all_non_zeros(std::vector<curve_element> &vec) {
+                            std::vector<curve_element<params_type, form, typename curves::coordinates::affine>>
+                                affine_vec(vec.size());
+                            algebra::batch_to_affine(vec.begin(), vec.end(), affine_vec.begin());
+
+                            for (std::size_t i = 0; i < vec.size(); ++i) {
+                                vec[i] = curve_element(affine_vec[i].X, affine_vec[i].Y, field_value_type::one());
+                            }
+                        }
+
                         /*************************  Arithmetic operations  ***********************************/
 
                         constexpr curve_element operator=(const curve_element &other) {
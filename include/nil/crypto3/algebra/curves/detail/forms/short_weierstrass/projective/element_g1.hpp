@@ -27,6 +27,7 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_HPP
 #define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_HPP
 
+#include <nil/crypto3/algebra/batch_to_affine.hpp>
 #include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
 #include <nil/crypto3/algebra/curves/forms.hpp>
 
@@ -193,6 +194,44 @@ namespace nil {
                             return result_type(X * Z.inversed(), Y * Z.inversed());    //  x=X/Z, y=Y/Z
                         }
 
+                        /** @brief
+                         *
+                         * @return the value whose inverse gives the affine coordinates, see batch_to_affine
+                         */
+                        constexpr field_value_type affine_denominator() const {
+                            return Z;
+                        }
+
+                        /** @brief
+                         *
+                         * @return the corresponding affine point, given the inverse of affine_denominator()
+                         */
+                        constexpr curve_element<params_type, form, typename curves::coordinates::affine>
+                            to_affine(const field_value_type &denominator_inversed) const {
+
+                            using result_type = curve_element<params_type, form, typename curves::coordinates::affine>;
+
+                            if (is_zero()) {
+                                return result_type::zero();
+                            }
+
+                            return result_type(X * denominator_inversed, Y * denominator_inversed);    //  x=X/Z, y=Y/Z
+                        }
+
+                        /** @brief Brings every point of the vector to the special form Z = 1,
+                         *  sharing a single field inversion among all of them, see batch_to_affine.
+                         *  All the points must be non-zero.
+                         */
+                        static void batch_to_special_all_non_zeros(std::vector<curve_element> &vec) {
+                            std::vector<curve_element<params_type, form, typename curves::coordinates::affine>>
+                                affine_vec(vec.size());
+                            algebra::batch_to_affine(vec.begin(), vec.end(), affine_vec.begin());
+
+                            for (std::size_t i = 0; i < vec.size(); ++i) {
+                                vec[i] = curve_element(affine_vec[i].X, affine_vec[i].Y, field_value_type::one());
+                            }
+                        }
+
                         /*************************  Arithmetic operations  ***********************************/
 
                         constexpr curve_element operator=(const curve_element &other) {
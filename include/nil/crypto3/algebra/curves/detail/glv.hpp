@@ -0,0 +1,184 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_GLV_HPP
+#define CRYPTO3_ALGEBRA_CURVES_GLV_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <nil/crypto3/multiprecision/wnaf.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /**
+                     * @brief GLV parameters of a group with an efficiently computable endomorphism
+                     * phi(x, y) = (beta * x, y), acting on the prime order subgroup as multiplication by lambda.
+                     *
+                     * Specializations are keyed by the group params type and provide:
+                     *  - beta, a non-trivial cube root of unity in the base field;
+                     *  - lambda, the matching cube root of unity in the scalar field;
+                     *  - g1, g2 and shift, the Babai rounding constants round(2^shift * |b2| / r) and
+                     *    round(2^shift * |b1| / r) of a short lattice basis (a1, b1), (a2, b2);
+                     *  - minus_b1 and minus_b2, the basis coefficients with the rounding signs folded in,
+                     *    so that k2 = c1 * minus_b1 + c2 * minus_b2 and k1 = k - k2 * lambda.
+                     *
+                     * The primary template is empty, which disables GLV multiplication for the group.
+                     */
+                    template<typename CurveParams>
+                    struct glv_params { };
+
+                    /// True if multiplication of GroupValueType by FieldValueType can go through GLV
+                    template<typename GroupValueType, typename FieldValueType, typename = void>
+                    struct has_glv_scalar_mul : std::false_type { };
+
+                    template<typename GroupValueType, typename FieldValueType>
+                    struct has_glv_scalar_mul<
+                        GroupValueType, FieldValueType,
+                        std::void_t<decltype(glv_params<typename GroupValueType::params_type>::lambda)>>
+                        : std::integral_constant<
+                              bool,
+                              std::is_same<typename FieldValueType::field_type,
+                                           typename glv_params<
+                                               typename GroupValueType::params_type>::scalar_field_type>::value &&
+                                  (std::is_same<typename GroupValueType::coordinates,
+                                                coordinates::jacobian_with_a4_0>::value ||
+                                   std::is_same<typename GroupValueType::coordinates, coordinates::jacobian>::value ||
+                                   std::is_same<typename GroupValueType::coordinates,
+                                                coordinates::projective>::value)> { };
+
+                    /** @brief Splits a scalar k into k1 + k2 * lambda with |k1|, |k2| about sqrt(r).
+                     *
+                     * Magnitudes are kept in k, signs in negative.
+                     */
+                    template<typename CurveParams>
+                    struct glv_decomposition {
+                        typedef glv_params<CurveParams> params_type;
+                        typedef typename params_type::scalar_field_type scalar_field_type;
+                        typedef typename scalar_field_type::value_type scalar_field_value_type;
+                        typedef typename scalar_field_type::integral_type integral_type;
+                        typedef typename scalar_field_type::extended_integral_type extended_integral_type;
+
+                        std::array<integral_type, 2> k;
+                        std::array<bool, 2> negative;
+
+                        explicit glv_decomposition(const scalar_field_value_type &scalar) {
+                            const extended_integral_type wide(scalar.data.template convert_to<integral_type>());
+                            const extended_integral_type half = extended_integral_type(1) << (params_type::shift - 1);
+
+                            const scalar_field_value_type c1(
+                                integral_type((wide * params_type::g1 + half) >> params_type::shift));
+                            const scalar_field_value_type c2(
+                                integral_type((wide * params_type::g2 + half) >> params_type::shift));
+
+                            const scalar_field_value_type k2 = c1 * params_type::minus_b1 + c2 * params_type::minus_b2;
+                            const scalar_field_value_type k1 = scalar - k2 * params_type::lambda;
+
+                            assign(0, k1);
+                            assign(1, k2);
+                        }
+
+                    private:
+                        void assign(std::size_t i, const scalar_field_value_type &value) {
+                            const integral_type v = value.data.template convert_to<integral_type>();
+                            negative[i] = v > (scalar_field_type::modulus >> 1);
+                            k[i] = negative[i] ? (-value).data.template convert_to<integral_type>() : v;
+                        }
+                    };
+
+                    /// phi(P) = (beta * X, Y, Z), valid for affine-on-X representations (jacobian and projective)
+                    template<typename GroupValueType>
+                    GroupValueType glv_endomorphism(const GroupValueType &point) {
+                        return GroupValueType(glv_params<typename GroupValueType::params_type>::beta * point.X,
+                                              point.Y, point.Z);
+                    }
+
+                    /** @brief Multiplication of a prime order subgroup element by a scalar field element using
+                     * GLV decomposition and interleaved (Straus) wNAF over P and phi(P).
+                     *
+                     * Only valid for points of order r, where phi acts as multiplication by lambda.
+                     */
+                    template<typename GroupValueType, typename FieldValueType>
+                    GroupValueType glv_scalar_mul(const GroupValueType &base, const FieldValueType &scalar) {
+                        constexpr static const std::size_t window_size = 4;
+                        constexpr static const std::size_t table_size = std::size_t(1) << (window_size - 1);
+
+                        const glv_decomposition<typename GroupValueType::params_type> decomposition(scalar);
+
+                        const std::array<std::vector<long>, 2> naf = {
+                            multiprecision::find_wnaf(window_size, decomposition.k[0]),
+                            multiprecision::find_wnaf(window_size, decomposition.k[1])};
+
+                        // table[0][i] = (2i + 1) * (+-P), table[1][i] = (2i + 1) * (+-phi(P))
+                        std::array<std::array<GroupValueType, table_size>, 2> table;
+                        table[0][0] = decomposition.negative[0] ? -base : base;
+                        const GroupValueType dbl = table[0][0].doubled();
+                        for (std::size_t i = 1; i < table_size; ++i) {
+                            table[0][i] = table[0][i - 1] + dbl;
+                        }
+                        for (std::size_t i = 0; i < table_size; ++i) {
+                            table[1][i] = glv_endomorphism(table[0][i]);
+                            if (decomposition.negative[0] != decomposition.negative[1]) {
+                                table[1][i] = -table[1][i];
+                            }
+                        }
+
+                        GroupValueType result = GroupValueType::zero();
+                        bool found_nonzero = false;
+                        for (long i = static_cast<long>(std::max(naf[0].size(), naf[1].size())) - 1; i >= 0; --i) {
+                            if (found_nonzero) {
+                                result = result.doubled();
+                            }
+
+                            for (std::size_t j = 0; j < 2; ++j) {
+                                if (static_cast<std::size_t>(i) >= naf[j].size() || naf[j][i] == 0) {
+                                    continue;
+                                }
+                                found_nonzero = true;
+                                if (naf[j][i] > 0) {
+                                    result = result + table[j][naf[j][i] / 2];
+                                } else {
+                                    result = result - table[j][(-naf[j][i]) / 2];
+                                }
+                            }
+                        }
+
+                        return result;
+                    }
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_GLV_HPP
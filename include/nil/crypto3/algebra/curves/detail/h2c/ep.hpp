@@ -28,7 +28,9 @@
 
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_suites.hpp>
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_m2c.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_cofactor.hpp>
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_expand.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_batch.hpp>
 
 #include <type_traits>
 
@@ -75,6 +77,45 @@ namespace nil {
                             return clear_cofactor(Q0 + Q1);
                         }
 
+                        /// Same as above for messages hashed under a domain separation tag prepared once
+                        template<typename InputType,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputType::value_type>::value>::type>
+                        static inline group_value_type
+                            hash_to_curve(const InputType &msg,
+                                          const typename expand_message_ro::dst_context &context) {
+                            auto u = hash_to_field<2>(msg, context);
+                            group_value_type Q0 = map_to_curve<GroupType>::process(u[0]);
+                            group_value_type Q1 = map_to_curve<GroupType>::process(u[1]);
+                            return clear_cofactor(Q0 + Q1);
+                        }
+
+                        /**
+                         * Hashes every message of the range msgs, see detail::hash_to_curve_batch.
+                         * The resulting points are in the special form Z = 1.
+                         */
+                        template<typename InputRange, typename DstType, typename OutputIterator, typename Executor,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputRange::value_type::value_type>::value &&
+                                     std::is_same<std::uint8_t, typename DstType::value_type>::value>::type>
+                        static inline OutputIterator hash_to_curve_batch(const InputRange &msgs, const DstType &dst,
+                                                                         OutputIterator out,
+                                                                         const std::size_t chunks_count,
+                                                                         Executor &&executor) {
+                            return detail::hash_to_curve_batch<ep_map>(msgs, typename expand_message_ro::dst_context(dst),
+                                                                     out, chunks_count,
+                                                                     std::forward<Executor>(executor));
+                        }
+
+                        template<typename InputRange, typename DstType, typename OutputIterator,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputRange::value_type::value_type>::value &&
+                                     std::is_same<std::uint8_t, typename DstType::value_type>::value>::type>
+                        static inline OutputIterator hash_to_curve_batch(const InputRange &msgs, const DstType &dst,
+                                                                         OutputIterator out) {
+                            return hash_to_curve_batch(msgs, dst, out, default_chunks_count(), async_executor());
+                        }
+
                         // template<typename InputType, typename = typename std::enable_if<std::is_same<
                         //                                  std::uint8_t, typename InputType::value_type>::value>::type>
                         // static inline group_value_type encode_to_curve(const InputType &msg) {
@@ -93,6 +134,24 @@ namespace nil {
                             std::array<std::uint8_t, N * m * L> uniform_bytes {0};
                             expand_message_type::process(N * m * L, msg, dst, uniform_bytes);
 
+                            return uniform_bytes_to_field<N>(uniform_bytes);
+                        }
+
+                        template<std::size_t N, typename InputType,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputType::value_type>::value>::type>
+                        static inline std::array<field_value_type, N>
+                            hash_to_field(const InputType &msg,
+                                          const typename expand_message_ro::dst_context &context) {
+                            std::array<std::uint8_t, N * m * L> uniform_bytes {0};
+                            context.process(N * m * L, msg.begin(), msg.end(), uniform_bytes.begin());
+
+                            return uniform_bytes_to_field<N>(uniform_bytes);
+                        }
+
+                        template<std::size_t N>
+                        static inline std::array<field_value_type, N>
+                            uniform_bytes_to_field(const std::array<std::uint8_t, N * m * L> &uniform_bytes) {
                             cpp_int e;
                             std::array<modular_type, m> coordinates;
                             std::array<field_value_type, N> result;
@@ -109,8 +168,9 @@ namespace nil {
                             return result;
                         }
 
+                        /// [h_eff]R, computed by the method cofactor_clearing selects for the group
                         static inline group_value_type clear_cofactor(const group_value_type &R) {
-                            return R * suite_type::h_eff;
+                            return cofactor_clearing<GroupType>::process(R);
                         }
                     };
                 }    // namespace detail
@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_BATCH_HPP
+#define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_BATCH_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <nil/crypto3/algebra/parallelization.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * @brief Hashes every message of the range to the curve of H2CType and writes the
+                     * points to out, in the order of the messages.
+                     *
+                     * The messages are split into chunks_count slices processed through the executor.
+                     * Mapping to the curve is inversion-free, so the only inversions left are the ones
+                     * bringing the points to the special form Z = 1: a single batch inversion per slice.
+                     * The points written are thus ready to be used as affine points, e.g. for the
+                     * Miller loop precomputation.
+                     */
+                    template<typename H2CType, typename InputRange, typename OutputIterator, typename Executor>
+                    OutputIterator hash_to_curve_batch(const InputRange &msgs,
+                                                       const typename H2CType::expand_message_ro::dst_context &context,
+                                                       OutputIterator out, const std::size_t chunks_count,
+                                                       Executor &&executor) {
+                        typedef typename H2CType::group_value_type group_value_type;
+
+                        const std::size_t size = std::distance(std::begin(msgs), std::end(msgs));
+                        std::vector<group_value_type> points(size);
+
+                        algebra::detail::parallel_for_chunks(
+                            std::forward<Executor>(executor), size, chunks_count,
+                            [&msgs, &context, &points](std::size_t begin, std::size_t end) {
+                                std::vector<group_value_type> non_zeros;
+                                std::vector<std::size_t> non_zero_indices;
+                                non_zeros.reserve(end - begin);
+                                non_zero_indices.reserve(end - begin);
+
+                                auto msg_it = std::next(std::begin(msgs), begin);
+                                for (std::size_t i = begin; i < end; ++i, ++msg_it) {
+                                    points[i] = H2CType::hash_to_curve(*msg_it, context);
+                                    if (!points[i].is_zero()) {
+                                        non_zeros.emplace_back(points[i]);
+                                        non_zero_indices.emplace_back(i);
+                                    }
+                                }
+
+                                group_value_type::batch_to_special_all_non_zeros(non_zeros);
+
+                                for (std::size_t j = 0; j < non_zeros.size(); ++j) {
+                                    points[non_zero_indices[j]] = non_zeros[j];
+                                }
+                            });
+
+                        return std::copy(points.begin(), points.end(), out);
+                    }
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_BATCH_HPP
@@ -0,0 +1,153 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_CLEAR_COFACTOR_HPP
+#define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_CLEAR_COFACTOR_HPP
+
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_suites.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /// Curves of prime order, h_eff = 1
+                    template<typename GroupType>
+                    struct cc_identity {
+                        typedef typename h2c_suite<GroupType>::group_value_type group_value_type;
+
+                        static inline group_value_type process(const group_value_type &R) {
+                            return R;
+                        }
+                    };
+
+                    template<typename GroupType>
+                    struct cc_mul_by_z {
+                        typedef h2c_suite<GroupType> suite_type;
+                        typedef typename suite_type::group_value_type group_value_type;
+
+                        static inline group_value_type process(const group_value_type &R) {
+                            const group_value_type z_R = R * suite_type::z;
+                            return suite_type::z_is_negative ? -z_R : z_R;
+                        }
+                    };
+
+                    /// [h_eff]R computed as [1 - z]R, https://www.rfc-editor.org/rfc/rfc9380#section-7
+                    template<typename GroupType>
+                    struct cc_bls12_g1 {
+                        typedef typename h2c_suite<GroupType>::group_value_type group_value_type;
+
+                        static inline group_value_type process(const group_value_type &R) {
+                            return R - cc_mul_by_z<GroupType>::process(R);
+                        }
+                    };
+
+                    /**
+                     * @brief [h_eff]R by the method of Budroni and Pintore, with psi the untwist-Frobenius-twist
+                     * endomorphism: [z^2 - z - 1]R + [z - 1]psi(R) + psi^2(2R).
+                     *
+                     * https://www.rfc-editor.org/rfc/rfc9380#appendix-G.3
+                     */
+                    template<typename GroupType>
+                    struct cc_bls12_g2 {
+                        typedef typename h2c_suite<GroupType>::group_value_type group_value_type;
+                        typedef cc_mul_by_z<GroupType> mul_by_z;
+
+                        static inline group_value_type process(const group_value_type &R) {
+                            const group_value_type t1 = mul_by_z::process(R);
+                            group_value_type t2 = subgroup_check_psi(R);
+                            group_value_type t3 = subgroup_check_psi(subgroup_check_psi(R.doubled()));
+                            t3 = t3 - t2;
+                            t2 = mul_by_z::process(t1 + t2);
+                            t3 = t3 + t2;
+                            t3 = t3 - t1;
+                            return t3 - R;
+                        }
+                    };
+
+                    /**
+                     * @brief [h_eff]R for G2 of BN curves by the method of Fuentes-Castaneda, Knapp and
+                     * Rodriguez-Henriquez: [z]R + psi([3z]R) + psi^2([z]R) + psi^3(R), where h_eff is
+                     * a multiple of the cofactor.
+                     *
+                     * https://doi.org/10.1007/978-3-642-28496-0_25
+                     */
+                    template<typename GroupType>
+                    struct cc_bn_g2 {
+                        typedef typename h2c_suite<GroupType>::group_value_type group_value_type;
+                        typedef cc_mul_by_z<GroupType> mul_by_z;
+
+                        static inline group_value_type process(const group_value_type &R) {
+                            const group_value_type z_R = mul_by_z::process(R);
+                            // psi([3z]R + psi([z]R) + psi^2(R))
+                            group_value_type t = subgroup_check_psi(subgroup_check_psi(R)) + subgroup_check_psi(z_R);
+                            t = subgroup_check_psi(t + z_R.doubled() + z_R);
+                            return z_R + t;
+                        }
+                    };
+
+                    template<typename GroupType>
+                    struct cofactor_clearing;
+
+                    template<>
+                    struct cofactor_clearing<typename bls12_381::g1_type<>>
+                        : cc_bls12_g1<typename bls12_381::g1_type<>> { };
+
+                    template<>
+                    struct cofactor_clearing<typename bls12_381::g2_type<>>
+                        : cc_bls12_g2<typename bls12_381::g2_type<>> { };
+
+                    template<>
+                    struct cofactor_clearing<typename alt_bn128_254::g1_type<>>
+                        : cc_identity<typename alt_bn128_254::g1_type<>> { };
+
+                    template<>
+                    struct cofactor_clearing<typename alt_bn128_254::g2_type<>>
+                        : cc_bn_g2<typename alt_bn128_254::g2_type<>> { };
+
+                    template<>
+                    struct cofactor_clearing<typename pallas::g1_type<>>
+                        : cc_identity<typename pallas::g1_type<>> { };
+
+                    template<>
+                    struct cofactor_clearing<typename vesta::g1_type<>>
+                        : cc_identity<typename vesta::g1_type<>> { };
+
+                    template<>
+                    struct cofactor_clearing<typename secp256k1::g1_type<>>
+                        : cc_identity<typename secp256k1::g1_type<>> { };
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_CLEAR_COFACTOR_HPP
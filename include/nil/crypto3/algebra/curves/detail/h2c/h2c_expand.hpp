@@ -40,6 +40,7 @@
 #include <boost/static_assert.hpp>
 #include <boost/concept/assert.hpp>
 
+#include <algorithm>
 #include <array>
 #include <type_traits>
 #include <iterator>
@@ -66,7 +67,115 @@ namespace nil {
 
                         constexpr static const std::array<std::uint8_t, r_in_bytes> Z_pad {0};
 
+                        typedef typename HashType::digest_type digest_type;
+                        typedef accumulator_set<HashType> accumulator_type;
+
                     public:
+                        /**
+                         * @brief Expansion state for a fixed domain separation tag.
+                         *
+                         * Keeps the hash state after Z_pad and DST_prime = DST || I2OSP(len(DST), 1), so
+                         * messages hashed under the same tag only absorb msg and the per-call suffixes.
+                         * The message is read from any input iterator and the output is written through an
+                         * output iterator, nothing is allocated on the heap.
+                         */
+                        class dst_context {
+                        public:
+                            template<typename InputDstType,
+                                     typename = typename std::enable_if<
+                                         std::is_same<std::uint8_t, typename InputDstType::value_type>::value>::type>
+                            explicit dst_context(const InputDstType &dst) : dst_prime_size(0) {
+                                BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<InputDstType>));
+
+                                // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.1
+                                BOOST_ASSERT(std::distance(dst.begin(), dst.end()) >= 16 &&
+                                             std::distance(dst.begin(), dst.end()) <= 255);
+
+                                for (auto it = dst.begin(); it != dst.end() && dst_prime_size < 255; ++it) {
+                                    dst_prime[dst_prime_size++] = *it;
+                                }
+                                dst_prime[dst_prime_size] = static_cast<std::uint8_t>(dst_prime_size);
+                                ++dst_prime_size;
+
+                                hash<HashType>(Z_pad.begin(), Z_pad.end(), z_pad_acc);
+                            }
+
+                            template<typename InputIterator, typename OutputIterator>
+                            OutputIterator process(const std::size_t len_in_bytes, InputIterator msg_first,
+                                                   InputIterator msg_last, OutputIterator out) const {
+                                // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.1
+                                BOOST_ASSERT(len_in_bytes < 0x10000);
+
+                                const std::size_t ell = static_cast<std::size_t>(len_in_bytes / b_in_bytes) +
+                                                        static_cast<std::size_t>(len_in_bytes % b_in_bytes != 0);
+
+                                // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.1
+                                BOOST_ASSERT(ell <= 255);
+
+                                // l_i_b_str || I2OSP(0, 1)
+                                const std::array<std::uint8_t, 3> msg_suffix = {
+                                    static_cast<std::uint8_t>(len_in_bytes >> 8u),
+                                    static_cast<std::uint8_t>(len_in_bytes % 0x100), 0};
+
+                                accumulator_type b0_acc = z_pad_acc;
+                                hash<HashType>(msg_first, msg_last, b0_acc);
+                                hash<HashType>(msg_suffix.begin(), msg_suffix.end(), b0_acc);
+                                absorb_dst_prime(b0_acc);
+                                const digest_type b0 = accumulators::extract::hash<HashType>(b0_acc);
+
+                                digest_type bi = b0;
+                                digest_type xored_b;
+                                std::size_t remaining = len_in_bytes;
+                                for (std::size_t i = 1; i <= ell; i++) {
+                                    // b_1 = H(b_0 || I2OSP(1, 1) || DST_prime),
+                                    // b_i = H(strxor(b_0, b_(i - 1)) || I2OSP(i, 1) || DST_prime)
+                                    if (i == 1) {
+                                        xored_b = b0;
+                                    } else {
+                                        strxor(b0, bi, xored_b);
+                                    }
+                                    const std::array<std::uint8_t, 1> i_str = {static_cast<std::uint8_t>(i)};
+
+                                    accumulator_type bi_acc;
+                                    hash<HashType>(xored_b.begin(), xored_b.end(), bi_acc);
+                                    hash<HashType>(i_str.begin(), i_str.end(), bi_acc);
+                                    absorb_dst_prime(bi_acc);
+                                    bi = accumulators::extract::hash<HashType>(bi_acc);
+
+                                    const std::size_t chunk_size = std::min(remaining, b_in_bytes);
+                                    out = std::copy(bi.begin(), bi.begin() + chunk_size, out);
+                                    remaining -= chunk_size;
+                                }
+
+                                return out;
+                            }
+
+                            template<typename InputMsgType, typename OutputType,
+                                     typename = typename std::enable_if<
+                                         std::is_same<std::uint8_t, typename InputMsgType::value_type>::value &&
+                                         std::is_same<std::uint8_t, typename OutputType::value_type>::value>::type>
+                            void process(const std::size_t len_in_bytes, const InputMsgType &msg,
+                                         OutputType &uniform_bytes) const {
+                                BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<InputMsgType>));
+                                BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<OutputType>));
+                                BOOST_CONCEPT_ASSERT((boost::WriteableRangeConcept<OutputType>));
+
+                                BOOST_ASSERT(std::distance(uniform_bytes.begin(), uniform_bytes.end()) >=
+                                             len_in_bytes);
+
+                                process(len_in_bytes, msg.begin(), msg.end(), uniform_bytes.begin());
+                            }
+
+                        private:
+                            void absorb_dst_prime(accumulator_type &acc) const {
+                                hash<HashType>(dst_prime.begin(), dst_prime.begin() + dst_prime_size, acc);
+                            }
+
+                            accumulator_type z_pad_acc;
+                            std::array<std::uint8_t, 256> dst_prime;
+                            std::size_t dst_prime_size;
+                        };
+
                         template<typename InputMsgType, typename InputDstType, typename OutputType,
                                  typename = typename std::enable_if<
                                      std::is_same<std::uint8_t, typename InputMsgType::value_type>::value &&
@@ -74,86 +183,7 @@ namespace nil {
                                      std::is_same<std::uint8_t, typename OutputType::value_type>::value>::type>
                         static inline void process(const std::size_t len_in_bytes, const InputMsgType &msg,
                                                    const InputDstType &dst, OutputType &uniform_bytes) {
-                            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<InputMsgType>));
-                            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<InputDstType>));
-                            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<OutputType>));
-                            BOOST_CONCEPT_ASSERT((boost::WriteableRangeConcept<OutputType>));
-
-                            // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.1
-                            BOOST_ASSERT(len_in_bytes < 0x10000);
-                            BOOST_ASSERT(std::distance(dst.begin(), dst.end()) >= 16 &&
-                                         std::distance(dst.begin(), dst.end()) <= 255);
-                            BOOST_ASSERT(std::distance(uniform_bytes.begin(), uniform_bytes.end()) >= len_in_bytes);
-
-                            const std::array<std::uint8_t, 2> l_i_b_str = {
-                                static_cast<std::uint8_t>(len_in_bytes >> 8u),
-                                static_cast<std::uint8_t>(len_in_bytes % 0x100)};
-                            const std::size_t ell = static_cast<std::size_t>(len_in_bytes / b_in_bytes) +
-                                                    static_cast<std::size_t>(len_in_bytes % b_in_bytes != 0);
-
-                            // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.1
-                            BOOST_ASSERT(ell <= 255);
-
-                            // TODO: use accumulators when they will be fixed
-                            // accumulator_set<HashType> b0_acc;
-                            // hash<HashType>(Z_pad, b0_acc);
-                            // hash<HashType>(msg, b0_acc);
-                            // hash<HashType>(l_i_b_str, b0_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {0}, b0_acc);
-                            // hash<HashType>(dst, b0_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(dst.size())},
-                            // b0_acc); typename HashType::digest_type b0 =
-                            // accumulators::extract::hash<HashType>(b0_acc);
-                            std::vector<std::uint8_t> msg_prime;
-                            msg_prime.insert(msg_prime.end(), Z_pad.begin(), Z_pad.end());
-                            msg_prime.insert(msg_prime.end(), msg.begin(), msg.end());
-                            msg_prime.insert(msg_prime.end(), l_i_b_str.begin(), l_i_b_str.end());
-                            msg_prime.insert(msg_prime.end(), static_cast<std::uint8_t>(0));
-                            msg_prime.insert(msg_prime.end(), dst.begin(), dst.end());
-                            msg_prime.insert(msg_prime.end(),
-                                             static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end())));
-                            typename HashType::digest_type b0 = hash<HashType>(msg_prime);
-
-                            // TODO: use accumulators when they will be fixed
-                            // accumulator_set<HashType> bi_acc;
-                            // hash<HashType>(b0, bi_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {1}, bi_acc);
-                            // hash<HashType>(dst, bi_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(dst.size())},
-                            // bi_acc); typename HashType::digest_type bi =
-                            // accumulators::extract::hash<HashType>(bi_acc); std::copy(bi.begin(), bi.end(),
-                            // uniform_bytes.begin());
-                            std::vector<std::uint8_t> b_i_str;
-                            b_i_str.insert(b_i_str.end(), b0.begin(), b0.end());
-                            b_i_str.insert(b_i_str.end(), static_cast<std::uint8_t>(1));
-                            b_i_str.insert(b_i_str.end(), dst.begin(), dst.end());
-                            b_i_str.insert(b_i_str.end(),
-                                           static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end())));
-                            typename HashType::digest_type bi = hash<HashType>(b_i_str);
-                            std::copy(bi.begin(), bi.end(), uniform_bytes.begin());
-
-                            typename HashType::digest_type xored_b;
-                            for (std::size_t i = 2; i <= ell; i++) {
-                                // TODO: use accumulators when they will be fixed
-                                // accumulator_set<HashType> bi_acc;
-                                // strxor(b0, bi, xored_b);
-                                // hash<HashType>(xored_b, bi_acc);
-                                // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(i)}, bi_acc);
-                                // hash<HashType>(dst, bi_acc);
-                                // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(dst.size())},
-                                //                bi_acc);
-                                // bi = accumulators::extract::hash<HashType>(bi_acc);
-                                // std::copy(bi.begin(), bi.end(), uniform_bytes.begin() + (i - 1) * b_in_bytes);
-                                strxor(b0, bi, xored_b);
-                                std::vector<std::uint8_t> b_i_str;
-                                b_i_str.insert(b_i_str.end(), xored_b.begin(), xored_b.end());
-                                b_i_str.insert(b_i_str.end(), static_cast<std::uint8_t>(i));
-                                b_i_str.insert(b_i_str.end(), dst.begin(), dst.end());
-                                b_i_str.insert(b_i_str.end(),
-                                               static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end())));
-                                bi = hash<HashType>(b_i_str);
-                                std::copy(bi.begin(), bi.end(), uniform_bytes.begin() + (i - 1) * b_in_bytes);
-                            }
+                            dst_context(dst).process(len_in_bytes, msg, uniform_bytes);
                         }
                     };
                 }    // namespace detail
@@ -31,6 +31,10 @@
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_sgn0.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -44,6 +48,12 @@ namespace nil {
                         typedef typename suite_type::group_value_type group_value_type;
                         typedef typename suite_type::field_value_type field_value_type;
 
+                        /**
+                         * @brief Straight-line simplified SWU, returns the point in Jacobian coordinates
+                         * (x * den : y * den^3 : den) to skip the final inversion.
+                         *
+                         * https://www.rfc-editor.org/rfc/rfc9380#appendix-F.2
+                         */
                         static inline group_value_type process(const field_value_type &u) {
                             // TODO: We assume that Z meets the following criteria -- correct for predefined suites,
                             //  but wrong in general case
@@ -53,30 +63,131 @@ namespace nil {
                             // 2.  Z != -1 in F,
                             // 3.  the polynomial g(x) - Z is irreducible over F, and
                             // 4.  g(B / (Z * A)) is square in F.
-                            static const field_value_type one = field_value_type::one();
+                            const field_value_type tv1 = suite_type::Z * u.squared();
+                            field_value_type tv2 = tv1.squared() + tv1;
+                            const field_value_type tv3 = suite_type::Bi * (tv2 + field_value_type::one());
+                            // x denominator, Z * A replaces 0 for the exceptional inputs
+                            const field_value_type tv4 = suite_type::Ai * (tv2.is_zero() ? suite_type::Z : -tv2);
 
-                            field_value_type tv1 =
-                                (suite_type::Z.pow(2) * u.pow(4) + suite_type::Z * u.pow(2)).inversed();
-                            field_value_type x1 = (-suite_type::Bi / suite_type::Ai) * (one + tv1);
-                            if (tv1.is_zero()) {
-                                x1 = suite_type::Bi / (suite_type::Z * suite_type::Ai);
+                            field_value_type tv6 = tv4.squared();
+                            tv2 = (tv3.squared() + suite_type::Ai * tv6) * tv3;
+                            tv6 = tv6 * tv4;
+                            // gx1 = tv2 / tv6
+                            tv2 = tv2 + suite_type::Bi * tv6;
+
+                            field_value_type y1;
+                            const bool is_gx1_square = sqrt_ratio(tv2, tv6, y1);
+
+                            const field_value_type x = is_gx1_square ? tv3 : tv1 * tv3;
+                            field_value_type y = is_gx1_square ? y1 : tv1 * u * y1;
+                            if (sgn0(u) != sgn0(y)) {
+                                y = -y;
+                            }
+
+                            return group_value_type(x * tv4, y * tv4.squared() * tv4, tv4);
+                        }
+
+                        /**
+                         * @brief Sets y to sqrt(u / v) if u / v is square and to sqrt(Z * u / v) otherwise,
+                         * with a single exponentiation.
+                         *
+                         * https://www.rfc-editor.org/rfc/rfc9380#appendix-F.2.1.1
+                         * @return whether u / v is square
+                         */
+                        static inline bool sqrt_ratio(const field_value_type &u, const field_value_type &v,
+                                                      field_value_type &y) {
+                            constexpr static const std::size_t c1 = suite_type::sqrt_ratio_c1;
+
+                            const field_value_type one = field_value_type::one();
+
+                            field_value_type tv1 = suite_type::sqrt_ratio_c6;
+                            // v^(2^c1 - 1)
+                            field_value_type tv2 = v;
+                            for (std::size_t i = 1; i < c1; i++) {
+                                tv2 = tv2.squared() * v;
+                            }
+                            field_value_type tv3 = tv2.squared() * v;
+                            field_value_type tv5 = (u * tv3).pow(suite_type::sqrt_ratio_c3) * tv2;
+                            tv2 = tv5 * v;
+                            tv3 = tv5 * u;
+                            field_value_type tv4 = tv3 * tv2;
+
+                            // tv4^(2^(c1 - 1))
+                            tv5 = tv4;
+                            for (std::size_t i = 1; i < c1; i++) {
+                                tv5 = tv5.squared();
                             }
-                            field_value_type gx1 = x1.pow(3) + suite_type::Ai * x1 + suite_type::Bi;
-                            field_value_type x2 = suite_type::Z * u.pow(2) * x1;
-                            field_value_type gx2 = x2.pow(3) + suite_type::Ai * x2 + suite_type::Bi;
-                            field_value_type x, y;
-                            if (gx1.is_square()) {
-                                x = x1;
-                                y = gx1.sqrt();
-                            } else {
-                                x = x2;
-                                y = gx2.sqrt();
+                            const bool is_qr = (tv5 == one);
+
+                            tv2 = tv3 * suite_type::sqrt_ratio_c7;
+                            tv5 = tv4 * tv1;
+                            tv3 = is_qr ? tv3 : tv2;
+                            tv4 = is_qr ? tv4 : tv5;
+
+                            for (std::size_t i = c1; i >= 2; i--) {
+                                // tv4^(2^(i - 2))
+                                tv5 = tv4;
+                                for (std::size_t j = 2; j < i; j++) {
+                                    tv5 = tv5.squared();
+                                }
+                                const bool e1 = (tv5 == one);
+
+                                tv2 = tv3 * tv1;
+                                tv1 = tv1.squared();
+                                tv5 = tv4 * tv1;
+                                tv3 = e1 ? tv3 : tv2;
+                                tv4 = e1 ? tv4 : tv5;
                             }
+
+                            y = tv3;
+                            return is_qr;
+                        }
+                    };
+
+                    template<typename GroupType>
+                    struct m2c_svdw {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+
+                        /**
+                         * @brief Shallue-van de Woestijne map for curves where neither simplified SWU nor
+                         * an isogeny is available, e.g. BN curves. Returns the point in Jacobian coordinates.
+                         *
+                         * https://www.rfc-editor.org/rfc/rfc9380#appendix-F.1
+                         */
+                        static inline group_value_type process(const field_value_type &u) {
+                            const field_value_type one = field_value_type::one();
+
+                            field_value_type tv1 = u.squared() * suite_type::svdw_c1;
+                            const field_value_type tv2 = one + tv1;
+                            tv1 = one - tv1;
+                            field_value_type tv3 = tv1 * tv2;
+                            tv3 = tv3.is_zero() ? tv3 : tv3.inversed();
+                            const field_value_type tv4 = u * tv1 * tv3 * suite_type::svdw_c3;
+
+                            const field_value_type x1 = suite_type::svdw_c2 - tv4;
+                            const field_value_type x2 = suite_type::svdw_c2 + tv4;
+                            const field_value_type x3 =
+                                (tv2.squared() * tv3).squared() * suite_type::svdw_c4 + suite_type::Z;
+
+                            const bool e1 = g(x1).is_square();
+                            const bool e2 = !e1 && g(x2).is_square();
+                            const field_value_type x = e1 ? x1 : (e2 ? x2 : x3);
+
+                            field_value_type y = g(x).sqrt();
                             if (sgn0(u) != sgn0(y)) {
                                 y = -y;
                             }
+
                             return group_value_type(x, y, one);
                         }
+
+                    private:
+                        static inline field_value_type g(const field_value_type &x) {
+                            return (x.squared() + suite_type::A) * x + suite_type::B;
+                        }
                     };
 
                     template<typename GroupType>
@@ -102,6 +213,26 @@ namespace nil {
                     template<>
                     struct map_to_curve<typename bls12_381::g2_type<>>
                         : m2c_simple_swu_zeroAB<typename bls12_381::g2_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename alt_bn128_254::g1_type<>>
+                        : m2c_svdw<typename alt_bn128_254::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename alt_bn128_254::g2_type<>>
+                        : m2c_svdw<typename alt_bn128_254::g2_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename pallas::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename pallas::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename vesta::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename vesta::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename secp256k1::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename secp256k1::g1_type<>> { };
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
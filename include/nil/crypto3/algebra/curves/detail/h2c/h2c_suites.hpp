@@ -27,6 +27,10 @@
 #define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SUITES_HPP
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <nil/crypto3/hash/sha2.hpp>
@@ -55,6 +59,7 @@ namespace nil {
 
                         typedef typename group_type::value_type group_value_type;
                         typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::extended_integral_type extended_integral_type;
                         typedef typename group_type::field_type::modular_type modular_type;
                         typedef typename group_type::field_type::modular_backend modular_backend;
                         typedef typename group_type::field_type::value_type field_value_type;
@@ -74,6 +79,18 @@ namespace nil {
                             0x12e2908d11688030018b12e8753eee3b2016c1f0f24f4070a0b9c14fcef35ef55a23215a316ceaa5d1cc48e98e172be0_cppui381);
                         constexpr static inline const field_value_type Z = field_value_type(11);
                         constexpr static integral_type h_eff = 0xd201000000010001_cppui381;
+                        /// BLS parameter z = -0xd201000000010000, used to clear the cofactor
+                        constexpr static integral_type z = 0xd201000000010000_cppui64;
+                        constexpr static bool z_is_negative = true;
+
+                        // sqrt_ratio constants, https://www.rfc-editor.org/rfc/rfc9380#appendix-F.2.1.1
+                        constexpr static std::size_t sqrt_ratio_c1 = 1;
+                        constexpr static integral_type sqrt_ratio_c3 =
+                            0x680447A8E5FF9A692C6E9ED90D2EB35D91DD2E13CE144AFD9CC34A83DAC3D8907AAFFFFAC54FFFFEE7FBFFFFFFFEAAA_cppui379;
+                        constexpr static inline const field_value_type sqrt_ratio_c6 = field_value_type(
+                            0x1A0111EA397FE69A4B1BA7B6434BACD764774B84F38512BF6730D2A0F6B0F6241EABFFFEB153FFFFB9FEFFFFFFFFAAAA_cppui381);
+                        constexpr static inline const field_value_type sqrt_ratio_c7 = field_value_type(
+                            0x15A003E9FDAC3A056B72834A0A3E325ED0514982620F6DF530C37281C2BD61B5DFD8686A3DF7C7CE5C77B43E28F972E8_cppui381);
                     };
 
                     template<>
@@ -84,6 +101,7 @@ namespace nil {
 
                         typedef typename group_type::value_type group_value_type;
                         typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::extended_integral_type extended_integral_type;
                         typedef typename group_type::field_type::modular_type modular_type;
                         typedef typename group_type::field_type::modular_backend modular_backend;
                         typedef typename group_type::field_type::value_type field_value_type;
@@ -107,6 +125,241 @@ namespace nil {
 #endif
                         constexpr static inline auto h_eff =
                             0xbc69f08f2ee75b3584c6a0ea91b352888e2a8e9145ad7689986ff031508ffe1329c2f178731db956d82bf015d1212b02ec0ec69d7477c1ae954cbc06689f6a359894c0adebbf6b4e8020005aaa95551_cppui636;
+                        /// BLS parameter z = -0xd201000000010000, used to clear the cofactor
+                        constexpr static integral_type z = 0xd201000000010000_cppui64;
+                        constexpr static bool z_is_negative = true;
+
+                        // sqrt_ratio constants, https://www.rfc-editor.org/rfc/rfc9380#appendix-F.2.1.1
+                        constexpr static std::size_t sqrt_ratio_c1 = 3;
+                        constexpr static extended_integral_type sqrt_ratio_c3 =
+                            0x2A437A4B8C35FC74BD278EAA22F25E9E2DC90E50E7046B466E59E49349E8BD050A62CFD16DDCA6EF53149330978EF011D68619C86185C7B292E85A87091A04966BF91ED3E71B743162C338362113CFD7CED6B1D76382EAB26AA00001C718E3_cppui758;
+                        constexpr static inline const field_value_type sqrt_ratio_c6 = field_value_type(
+                            0x6AF0E0437FF400B6831E36D6BD17FFE48395DABC2D3435E77F76E17009241C5EE67992F72EC05F4C81084FBEDE3CC09_cppui379,
+                            0x6AF0E0437FF400B6831E36D6BD17FFE48395DABC2D3435E77F76E17009241C5EE67992F72EC05F4C81084FBEDE3CC09_cppui379);
+                        constexpr static inline const field_value_type sqrt_ratio_c7 = field_value_type(
+                            0x13DC0969311E2BA565924CB0B6F7BB9857F157E17F0C8DB4E484FCB27B8BE0B36DFA0340C422FB7EFE9D9A3234336D5E_cppui381,
+                            0x71D42AC9C54001A21ACF9187D469D919A830A2C969128D22659DC2F8263F1CA73C5B0E02C05EC381B8684A676A81381_cppui379);
+                    };
+
+                    template<>
+                    struct h2c_suite<typename secp256k1::g1_type<>> {
+                        typedef secp256k1 curve_type;
+                        typedef typename secp256k1::g1_type<> group_type;
+                        typedef hashes::sha2<256> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::extended_integral_type extended_integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // secp256k1_XMD:SHA-256_SSWU_RO_
+                        constexpr static std::array<std::uint8_t, 30> suite_id = {
+                            0x73, 0x65, 0x63, 0x70, 0x32, 0x35, 0x36, 0x6b, 0x31, 0x5f, 0x58,
+                            0x4d, 0x44, 0x3a, 0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f,
+                            0x53, 0x53, 0x57, 0x55, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        // 3-isogenous curve y^2 = x^3 + A'x + B', https://www.rfc-editor.org/rfc/rfc9380#section-8.7
+                        constexpr static inline const field_value_type Ai = field_value_type(
+                            0x3f8731abdd661adca08a5558f0f5d272e953d363cb6f0e5d405447c01a444533_cppui254);
+                        constexpr static inline const field_value_type Bi = field_value_type(1771);
+                        // Z = -11
+                        constexpr static inline const field_value_type Z = field_value_type(
+                            0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc24_cppui256);
+                        constexpr static integral_type h_eff = 1;
+
+                        // sqrt_ratio constants, https://www.rfc-editor.org/rfc/rfc9380#appendix-F.2.1.1
+                        constexpr static std::size_t sqrt_ratio_c1 = 1;
+                        constexpr static integral_type sqrt_ratio_c3 =
+                            0x3fffffffffffffffffffffffffffffffffffffffffffffffffffffffbfffff0b_cppui254;
+                        constexpr static inline const field_value_type sqrt_ratio_c6 = field_value_type(
+                            0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2e_cppui256);
+                        constexpr static inline const field_value_type sqrt_ratio_c7 = field_value_type(
+                            0x31fdf302724013e57ad13fb38f842afeec184f00a74789dd286729c8303c4a59_cppui254);
+                    };
+
+                    template<>
+                    struct h2c_suite<typename pallas::g1_type<>> {
+                        typedef pallas curve_type;
+                        typedef typename pallas::g1_type<> group_type;
+                        typedef hashes::sha2<256> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::extended_integral_type extended_integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // pallas_XMD:SHA-256_SSWU_RO_
+                        // Library-specific suite: RFC 9380 defines no such suite and it is not cross-checked against
+                        // another implementation, the test vectors come from test/hash_to_curve_vectors.py
+                        constexpr static std::array<std::uint8_t, 27> suite_id = {
+                            0x70, 0x61, 0x6c, 0x6c, 0x61, 0x73, 0x5f, 0x58, 0x4d, 0x44, 0x3a,
+                            0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f, 0x53, 0x53, 0x57,
+                            0x55, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        // 3-isogenous curve y^2 = x^3 + A'x + B'
+                        constexpr static inline const field_value_type Ai = field_value_type(
+                            0x18354a2eb0ea8c9c49be2d7258370742b74134581a27a59f92bb4b0b657a014b_cppui253);
+                        constexpr static inline const field_value_type Bi = field_value_type(1265);
+                        // Z = -13
+                        constexpr static inline const field_value_type Z = field_value_type(
+                            0x40000000000000000000000000000000224698fc094cf91b992d30ecfffffff4_cppui255);
+                        constexpr static integral_type h_eff = 1;
+
+                        // sqrt_ratio constants, https://www.rfc-editor.org/rfc/rfc9380#appendix-F.2.1.1
+                        constexpr static std::size_t sqrt_ratio_c1 = 32;
+                        constexpr static integral_type sqrt_ratio_c3 =
+                            0x2000000000000000000000000000000011234c7e04a67c8dcc969876_cppui222;
+                        constexpr static inline const field_value_type sqrt_ratio_c6 = field_value_type(
+                            0x3532c03204fba871900f0174278bfa48a84bde8a976e4e47a58f2ab23e9ea126_cppui254);
+                        constexpr static inline const field_value_type sqrt_ratio_c7 = field_value_type(
+                            0x3dc271c8308fca72f0b7a1a19440ccc7325f98710655bac58f7f70a4ccefc9e9_cppui254);
+                    };
+
+                    template<>
+                    struct h2c_suite<typename vesta::g1_type<>> {
+                        typedef vesta curve_type;
+                        typedef typename vesta::g1_type<> group_type;
+                        typedef hashes::sha2<256> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::extended_integral_type extended_integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // vesta_XMD:SHA-256_SSWU_RO_
+                        // Library-specific suite: RFC 9380 defines no such suite and it is not cross-checked against
+                        // another implementation, the test vectors come from test/hash_to_curve_vectors.py
+                        constexpr static std::array<std::uint8_t, 26> suite_id = {
+                            0x76, 0x65, 0x73, 0x74, 0x61, 0x5f, 0x58, 0x4d, 0x44, 0x3a, 0x53,
+                            0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f, 0x53, 0x53, 0x57, 0x55,
+                            0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        // 3-isogenous curve y^2 = x^3 + A'x + B'
+                        constexpr static inline const field_value_type Ai = field_value_type(
+                            0x267f9b2ee592271a81639c4d96f787739673928c7d01b212c515ad7242eaa6b1_cppui254);
+                        constexpr static inline const field_value_type Bi = field_value_type(1265);
+                        // Z = -13
+                        constexpr static inline const field_value_type Z = field_value_type(
+                            0x40000000000000000000000000000000224698fc0994a8dd8c46eb20fffffff4_cppui255);
+                        constexpr static integral_type h_eff = 1;
+
+                        // sqrt_ratio constants, https://www.rfc-editor.org/rfc/rfc9380#appendix-F.2.1.1
+                        constexpr static std::size_t sqrt_ratio_c1 = 32;
+                        constexpr static integral_type sqrt_ratio_c3 =
+                            0x2000000000000000000000000000000011234c7e04ca546ec6237590_cppui222;
+                        constexpr static inline const field_value_type sqrt_ratio_c6 = field_value_type(
+                            0x16915a9e3a85ecaa11685fd036be6bf8870326a1c5e594f7be27d905dd4b42e0_cppui253);
+                        constexpr static inline const field_value_type sqrt_ratio_c7 = field_value_type(
+                            0x2f5b4405e8f664f4cc83ce90eb785a677d2c72c8b07779a471604d7507c718f6_cppui254);
+                    };
+
+                    template<>
+                    struct h2c_suite<typename alt_bn128_254::g1_type<>> {
+                        typedef alt_bn128_254 curve_type;
+                        typedef typename alt_bn128_254::g1_type<> group_type;
+                        typedef hashes::sha2<256> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // BN254G1_XMD:SHA-256_SVDW_RO_
+                        // Library-specific suite: RFC 9380 defines no such suite and it is not cross-checked against
+                        // another implementation, the test vectors come from test/hash_to_curve_vectors.py
+                        constexpr static std::array<std::uint8_t, 28> suite_id = {
+                            0x42, 0x4e, 0x32, 0x35, 0x34, 0x47, 0x31, 0x5f, 0x58, 0x4d, 0x44,
+                            0x3a, 0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f, 0x53, 0x56,
+                            0x44, 0x57, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        constexpr static inline const field_value_type A = field_value_type(0);
+                        constexpr static inline const field_value_type B = field_value_type(3);
+                        constexpr static inline const field_value_type Z = field_value_type(1);
+                        constexpr static integral_type h_eff = 1;
+
+                        // Shallue-van de Woestijne constants, https://www.rfc-editor.org/rfc/rfc9380#section-6.6.1
+                        constexpr static inline const field_value_type svdw_c1 = field_value_type(4);
+                        constexpr static inline const field_value_type svdw_c2 = field_value_type(
+                            0x183227397098d014dc2822db40c0ac2ecbc0b548b438e5469e10460b6c3e7ea3_cppui253);
+                        constexpr static inline const field_value_type svdw_c3 = field_value_type(
+                            0x16789af3a83522eb353c98fc6b36d713d5d8d1cc5dffffffa_cppui193);
+                        constexpr static inline const field_value_type svdw_c4 = field_value_type(
+                            0x10216f7ba065e00de81ac1e7808072c9dd2b2385cd7b438469602eb24829a9bd_cppui253);
+                    };
+
+                    template<>
+                    struct h2c_suite<typename alt_bn128_254::g2_type<>> {
+                        typedef alt_bn128_254 curve_type;
+                        typedef typename alt_bn128_254::g2_type<> group_type;
+                        typedef hashes::sha2<256> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // BN254G2_XMD:SHA-256_SVDW_RO_
+                        // Library-specific suite: RFC 9380 defines no such suite and it is not cross-checked against
+                        // another implementation, the test vectors come from test/hash_to_curve_vectors.py
+                        constexpr static std::array<std::uint8_t, 28> suite_id = {
+                            0x42, 0x4e, 0x32, 0x35, 0x34, 0x47, 0x32, 0x5f, 0x58, 0x4d, 0x44,
+                            0x3a, 0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f, 0x53, 0x56,
+                            0x44, 0x57, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 2;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        constexpr static inline const field_value_type A = field_value_type(0, 0);
+                        constexpr static inline const field_value_type B = field_value_type(
+                            0x2b149d40ceb8aaae81be18991be06ac3b5b4c5e559dbefa33267e6dc24a138e5_cppui254,
+                            0x9713b03af0fed4cd2cafadeed8fdf4a74fa084e52d1852e4a2bd0685c315d2_cppui248);
+                        constexpr static inline const field_value_type Z = field_value_type(1, 0);
+                        // Not fixed by any standard, h_eff is the multiple of the cofactor that clear_cofactor computes
+                        // with the Fuentes-Castaneda, Knapp, Rodriguez-Henriquez method
+                        constexpr static inline auto h_eff =
+                            0x925c4b8763cbf9c489cc347d5abc08e052d4015a2223c4d4517bf2834b384f38d79b3f77302474029d14f3f70f8afb4a429874c0aeac6a1211b707a3206c1a3_cppui508;
+                        /// BN parameter z = 0x44e992b44a6909f1, used to clear the cofactor
+                        constexpr static integral_type z = 0x44e992b44a6909f1_cppui63;
+                        constexpr static bool z_is_negative = false;
+
+                        // Shallue-van de Woestijne constants, https://www.rfc-editor.org/rfc/rfc9380#section-6.6.1
+                        constexpr static inline const field_value_type svdw_c1 = field_value_type(
+                            0x2b149d40ceb8aaae81be18991be06ac3b5b4c5e559dbefa33267e6dc24a138e6_cppui254,
+                            0x9713b03af0fed4cd2cafadeed8fdf4a74fa084e52d1852e4a2bd0685c315d2_cppui248);
+                        constexpr static inline const field_value_type svdw_c2 = field_value_type(
+                            0x183227397098d014dc2822db40c0ac2ecbc0b548b438e5469e10460b6c3e7ea3_cppui253,
+                            0);
+                        constexpr static inline const field_value_type svdw_c3 = field_value_type(
+                            0x29fd332ab7260112b801fa95b21af64e2e6da55f90a3e510fcbe57377b5ca1ec_cppui254,
+                            0x303d1eff1426764bf8408aee24ba0b865e76f77b1267a846b1e9154d01565034_cppui254);
+                        constexpr static inline const field_value_type svdw_c4 = field_value_type(
+                            0x17365bbe63b1d2078632fe0eb2ac5a41b4e6a9c08b98676721010b008d4eaf99_cppui253,
+                            0xf57ffe5fc79e19cd689d7aa4209cad8fe164d7f4694786b388732a995d03755_cppui252);
                     };
                 }    // namespace detail
             }        // namespace curves
@@ -27,12 +27,15 @@
 #define CRYPTO3_MARSHALLING_ALGEBRA_CURVES_HPP
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/parallelization.hpp>
 
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
 #include <boost/concept/assert.hpp>
 
 #include <iterator>
+#include <utility>
+#include <vector>
 
 namespace nil {
     namespace marshalling {
@@ -183,6 +186,58 @@ namespace nil {
                 return uncompressed_to_g2_point(point_octets, m_byte);
             }
 
+            /**
+             * @brief Batch deserialization of compressed G1 points, e.g. verifying keys or public keys.
+             *
+             * The range of compressed_g1_octets is split into chunks_count slices decoded through the executor.
+             * Each point costs one exponentiation, which gives both the square root and the square check.
+             * Decoded points are produced with Z = 1, so no normalization is needed afterwards.
+             *
+             * @return false and the point at infinity in place of the malformed entries if any encoding
+             * is invalid, true otherwise
+             */
+            template<typename OctetsRange, typename Executor>
+            static inline std::pair<bool, std::vector<g1_value_type>>
+                compressed_octets_to_g1_points(const OctetsRange &octets, std::size_t chunks_count,
+                                               Executor &&executor) {
+                return batch_decompress<g1_value_type>(
+                    octets, chunks_count, std::forward<Executor>(executor),
+                    [](const compressed_g1_octets &point_octets, g1_value_type &point) {
+                        return decompress_g1_point(point_octets, point);
+                    });
+            }
+
+            template<typename OctetsRange>
+            static inline std::pair<bool, std::vector<g1_value_type>>
+                compressed_octets_to_g1_points(const OctetsRange &octets,
+                                               std::size_t chunks_count = algebra::default_chunks_count()) {
+                return compressed_octets_to_g1_points(octets, chunks_count, algebra::async_executor());
+            }
+
+            /**
+             * @brief Batch deserialization of compressed G2 points, see compressed_octets_to_g1_points.
+             *
+             * The Fp2 square root is taken through the norm: two Fp exponentiations per point and no
+             * inversion, instead of the generic Fp2 is_square() and sqrt().
+             */
+            template<typename OctetsRange, typename Executor>
+            static inline std::pair<bool, std::vector<g2_value_type>>
+                compressed_octets_to_g2_points(const OctetsRange &octets, std::size_t chunks_count,
+                                               Executor &&executor) {
+                return batch_decompress<g2_value_type>(
+                    octets, chunks_count, std::forward<Executor>(executor),
+                    [](const compressed_g2_octets &point_octets, g2_value_type &point) {
+                        return decompress_g2_point(point_octets, point);
+                    });
+            }
+
+            template<typename OctetsRange>
+            static inline std::pair<bool, std::vector<g2_value_type>>
+                compressed_octets_to_g2_points(const OctetsRange &octets,
+                                               std::size_t chunks_count = algebra::default_chunks_count()) {
+                return compressed_octets_to_g2_points(octets, chunks_count, algebra::async_executor());
+            }
+
         protected:
             constexpr static const std::uint8_t C_bit = 0x80;
             constexpr static const std::uint8_t I_bit = 0x40;
@@ -303,6 +358,164 @@ namespace nil {
                 return result;
             }
 
+            template<typename GroupValueType, typename OctetsRange, typename Executor, typename Decompress>
+            static inline std::pair<bool, std::vector<GroupValueType>>
+                batch_decompress(const OctetsRange &octets, std::size_t chunks_count, Executor &&executor,
+                                 Decompress decompress) {
+                const auto first = std::begin(octets);
+                const std::size_t size = std::distance(first, std::end(octets));
+
+                std::vector<GroupValueType> points(size);
+                if (size == 0) {
+                    return std::make_pair(true, std::move(points));
+                }
+
+                std::vector<bool> chunks_valid = algebra::detail::parallel_chunks(
+                    std::forward<Executor>(executor), size, chunks_count,
+                    [first, &points, decompress](std::size_t begin, std::size_t end) {
+                        bool valid = true;
+                        for (std::size_t i = begin; i < end; ++i) {
+                            if (!decompress(*std::next(first, i), points[i])) {
+                                points[i] = GroupValueType();
+                                valid = false;
+                            }
+                        }
+                        return valid;
+                    });
+
+                return std::make_pair(std::find(chunks_valid.begin(), chunks_valid.end(), false) == chunks_valid.end(),
+                                      std::move(points));
+            }
+
+            /// Checks the flags of a compressed encoding, copies it with the flags cleared into point_octets
+            template<typename PointOctets>
+            static inline bool read_compressed_m_byte(const PointOctets &octets, PointOctets &point_octets,
+                                                      std::uint8_t &m_byte) {
+                m_byte = octets[0] & 0xE0;
+                if (!(m_byte & C_bit) || m_byte == (C_bit | I_bit | S_bit)) {
+                    return false;
+                }
+                point_octets = octets;
+                point_octets[0] &= 0x1F;
+                if (m_byte & I_bit) {
+                    return std::find_if(point_octets.begin(), point_octets.end(),
+                                        [](std::uint8_t octet) { return octet != 0; }) == point_octets.end();
+                }
+                return true;
+            }
+
+            static inline bool import_field_element(compressed_g1_octets::const_reverse_iterator first,
+                                                    compressed_g1_octets::const_reverse_iterator last,
+                                                    g1_field_value_type &result) {
+                integral_type x;
+                multiprecision::import_bits(x, first, last, 8, false);
+                if (x >= g1_field_value_type::modulus) {
+                    return false;
+                }
+                result = g1_field_value_type(x);
+                return true;
+            }
+
+            /// G1 decompression with y = (x^3 + 4)^((p + 1) / 4), p = 3 mod 4, checked by squaring
+            static inline bool decompress_g1_point(const compressed_g1_octets &octets, g1_value_type &result) {
+                static const integral_type p_plus_1_over_4 = (g1_field_value_type::modulus + 1) >> 2;
+
+                compressed_g1_octets point_octets;
+                std::uint8_t m_byte;
+                if (!read_compressed_m_byte(octets, point_octets, m_byte)) {
+                    return false;
+                }
+                if (m_byte & I_bit) {
+                    result = g1_value_type();
+                    return true;
+                }
+
+                g1_field_value_type x;
+                if (!import_field_element(point_octets.crbegin(), point_octets.crend(), x)) {
+                    return false;
+                }
+                const g1_field_value_type y2 = x.squared() * x + g1_field_value_type(4);
+                g1_field_value_type y = y2.pow(p_plus_1_over_4);
+                if (y.squared() != y2) {
+                    return false;
+                }
+                if (sign_gf_p(y) != bool(m_byte & S_bit)) {
+                    y = -y;
+                }
+                result = g1_value_type(x, y, g1_field_value_type::one());
+                return true;
+            }
+
+            /**
+             * G2 decompression. For a = a0 + a1 * u, u^2 = -1, with n = a0^2 + a1^2 = s^2 and t = (a0 + s) / 2,
+             * c = t^((p - 3) / 4) gives sqrt(a) = t * c + a1 * c / 2 * u if t is a square (t * c^2 = 1)
+             * and a1 * c / 2 - t * c * u otherwise (t * c^2 = -1).
+             */
+            static inline bool decompress_g2_point(const compressed_g2_octets &octets, g2_value_type &result) {
+                static const integral_type p_plus_1_over_4 = (g1_field_value_type::modulus + 1) >> 2;
+                static const integral_type p_minus_3_over_4 = (g1_field_value_type::modulus - 3) >> 2;
+                static const g1_field_value_type two_inversed = g1_field_value_type(2).inversed();
+
+                compressed_g2_octets point_octets;
+                std::uint8_t m_byte;
+                if (!read_compressed_m_byte(octets, point_octets, m_byte)) {
+                    return false;
+                }
+                if (m_byte & I_bit) {
+                    result = g2_value_type();
+                    return true;
+                }
+
+                compressed_g1_octets x_0_octets, x_1_octets;
+                std::copy(point_octets.begin(), point_octets.begin() + sizeof_field_element, x_1_octets.begin());
+                std::copy(point_octets.begin() + sizeof_field_element, point_octets.end(), x_0_octets.begin());
+                g1_field_value_type x_0, x_1;
+                if (!import_field_element(x_0_octets.crbegin(), x_0_octets.crend(), x_0) ||
+                    !import_field_element(x_1_octets.crbegin(), x_1_octets.crend(), x_1)) {
+                    return false;
+                }
+
+                const g2_field_value_type x(x_0, x_1);
+                const g2_field_value_type y2 = x.squared() * x + g2_field_value_type(4, 4);
+                const g1_field_value_type &a_0 = y2.data[0];
+                const g1_field_value_type &a_1 = y2.data[1];
+
+                g2_field_value_type y;
+                if (a_1.is_zero()) {
+                    const g1_field_value_type c = a_0.pow(p_plus_1_over_4);
+                    if (c.squared() == a_0) {
+                        y = g2_field_value_type(c, g1_field_value_type::zero());
+                    } else if (c.squared() == -a_0) {
+                        y = g2_field_value_type(g1_field_value_type::zero(), c);
+                    } else {
+                        return false;
+                    }
+                } else {
+                    const g1_field_value_type n = a_0.squared() + a_1.squared();
+                    const g1_field_value_type s = n.pow(p_plus_1_over_4);
+                    if (s.squared() != n) {
+                        return false;
+                    }
+                    const g1_field_value_type t = (a_0 + s) * two_inversed;
+                    const g1_field_value_type c = t.pow(p_minus_3_over_4);
+                    const g1_field_value_type t_c = t * c;
+                    const g1_field_value_type t_c_c = t_c * c;
+                    if (t_c_c == g1_field_value_type::one()) {
+                        y = g2_field_value_type(t_c, a_1 * c * two_inversed);
+                    } else if (t_c_c == -g1_field_value_type::one()) {
+                        y = g2_field_value_type(a_1 * c * two_inversed, -t_c);
+                    } else {
+                        return false;
+                    }
+                }
+
+                if (sign_gf_p(y) != bool(m_byte & S_bit)) {
+                    y = -y;
+                }
+                result = g2_value_type(x, y, g2_field_value_type::one());
+                return true;
+            }
+
             static inline bool sign_gf_p(const g1_field_value_type &v) {
                 static const typename g1_field_value_type::integral_type half_p =
                     (g1_field_value_type::modulus - integral_type(1)) / integral_type(2);
@@ -28,6 +28,8 @@
 #define CRYPTO3_ALGEBRA_CURVES_SCALAR_MUL_HPP
 
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+#include <nil/crypto3/algebra/curves/detail/fixed_base_comb.hpp>
 
 #include <nil/crypto3/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
@@ -122,6 +124,17 @@ namespace nil {
                                             GroupValueType>::type
                         operator*(const GroupValueType &left, const FieldValueType &right) {
 
+                        // Multiples of the generator, e.g. key generation or random_element, are looked up
+                        // in its comb, the table being built on the first such multiplication.
+                        if constexpr (has_generator_comb<GroupValueType, FieldValueType>::value) {
+                            if (left == GroupValueType::one()) {
+                                return generator_comb<GroupValueType, typename FieldValueType::field_type>().mul(
+                                    right);
+                            }
+                        }
+
+                        // The point may lie outside the prime order subgroup, e.g. before cofactor clearing,
+                        // so the endomorphism is not used here, see mul_in_subgroup.
                         return left * right.data;
                     }
 
@@ -136,6 +149,22 @@ namespace nil {
                         return right * left;
                     }
 
+                    /**
+                     * @brief Multiplication of a point of the prime order subgroup by a scalar field element.
+                     *
+                     * Goes through glv_scalar_mul if the group has an endomorphism and through operator*
+                     * otherwise. The point has to be checked or known to lie in the subgroup, the result is
+                     * wrong for other points.
+                     */
+                    template<typename GroupValueType, typename FieldValueType>
+                    GroupValueType mul_in_subgroup(const GroupValueType &point, const FieldValueType &scalar) {
+                        if constexpr (has_glv_scalar_mul<GroupValueType, FieldValueType>::value) {
+                            return glv_scalar_mul(point, scalar);
+                        } else {
+                            return point * scalar;
+                        }
+                    }
+
                     template<typename GroupValueType>
                     constexpr GroupValueType operator*(const GroupValueType &left, const std::size_t &right) {
 
@@ -0,0 +1,97 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SECP_K1_256_GLV_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SECP_K1_256_GLV_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/secp_k1/256/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /**
+                     * @brief GLV constants of secp256k1: beta^3 = 1 in Fq, lambda^3 = 1 in Fr, phi(P) = lambda * P.
+                     *
+                     * Short basis of the lattice {(a, b) : a + b * lambda = 0 mod r}:
+                     *  a1 = 64502973549206556628585045361533709077, b1 = -303414439467246543595250775667605759171,
+                     *  a2 = 367917413016453100223835821029139468248, b2 = 64502973549206556628585045361533709077.
+                     */
+                    template<>
+                    struct glv_params<secp_k1_g1_params<256, forms::short_weierstrass>> {
+                        using base_field_type = typename secp_k1_g1_params<256, forms::short_weierstrass>::field_type;
+                        using scalar_field_type =
+                            typename secp_k1_g1_params<256, forms::short_weierstrass>::scalar_field_type;
+                        using extended_integral_type = typename scalar_field_type::extended_integral_type;
+
+                        constexpr static const typename base_field_type::value_type beta =
+                            typename base_field_type::value_type(
+                                0x7AE96A2B657C07106E64479EAC3434E99CF0497512F58995C1396C28719501EE_cppui255);
+                        constexpr static const typename scalar_field_type::value_type lambda =
+                            typename scalar_field_type::value_type(
+                                0x5363AD4CC05C30E0A5261C028812645A122E22EA20816678DF02967C1B23BD72_cppui255);
+
+                        constexpr static const std::size_t shift = 512;
+                        constexpr static const extended_integral_type g1 =
+                            0x3086D221A7D46BCDE86C90E49284EB153DAA8A1471E8CA7FE893209A45DBB030EA815BD6CA9C9971C2C7BD781AFB02A4_cppui382;
+                        constexpr static const extended_integral_type g2 =
+                            0xE4437ED6010E88286F547FA90ABFE4C4221208AC9DF506C61571B4AE8AC47F7146683369B37D763044180E526536385D_cppui384;
+                        constexpr static const typename scalar_field_type::value_type minus_b1 =
+                            typename scalar_field_type::value_type(
+                                0xE4437ED6010E88286F547FA90ABFE4C3_cppui128);
+                        constexpr static const typename scalar_field_type::value_type minus_b2 =
+                            typename scalar_field_type::value_type(
+                                0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE8A280AC50774346DD765CDA83DB1562C_cppui256);
+                    };
+
+                    constexpr typename glv_params<
+                        secp_k1_g1_params<256, forms::short_weierstrass>>::base_field_type::value_type const
+                        glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::beta;
+                    constexpr typename glv_params<
+                        secp_k1_g1_params<256, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::lambda;
+                    constexpr std::size_t const
+                        glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::shift;
+                    constexpr typename glv_params<
+                        secp_k1_g1_params<256, forms::short_weierstrass>>::extended_integral_type const
+                        glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::g1;
+                    constexpr typename glv_params<
+                        secp_k1_g1_params<256, forms::short_weierstrass>>::extended_integral_type const
+                        glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::g2;
+                    constexpr typename glv_params<
+                        secp_k1_g1_params<256, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::minus_b1;
+                    constexpr typename glv_params<
+                        secp_k1_g1_params<256, forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<secp_k1_g1_params<256, forms::short_weierstrass>>::minus_b2;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_SECP_K1_256_GLV_PARAMS_HPP
@@ -27,6 +27,7 @@
 #define CRYPTO3_ALGEBRA_CURVES_SECP_K1_G1_HPP
 
 #include <nil/crypto3/algebra/curves/detail/secp_k1/256/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/secp_k1/256/glv_params.hpp>
 
 #include <nil/crypto3/algebra/curves/forms.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/jacobian_with_a4_0/element_g1.hpp>
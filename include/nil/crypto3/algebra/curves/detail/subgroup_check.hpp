@@ -26,6 +26,9 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_SUBGROUP_CHECK_HPP
 #define CRYPTO3_ALGEBRA_CURVES_SUBGROUP_CHECK_HPP
 
+#include <cstddef>
+#include <type_traits>
+
 #include <nil/crypto3/algebra/type_traits.hpp>
 
 namespace nil {
@@ -41,9 +44,105 @@ namespace nil {
                     bool subgroup_check(const GroupValueType &p) {
                         return (p * GroupValueType::group_type::curve_type::q).is_zero();
                     }
+
+                    /**
+                     * @brief Prime order subgroup membership test used by a group.
+                     *
+                     * order: [r]P == 0, the generic fallback;
+                     * cofactor_one: every point of the curve belongs to the subgroup;
+                     * sigma: sigma(P) == [-u^2]P with sigma(x, y) = (omega * x, y), BLS12 G1
+                     *     (M. Scott, "A note on group membership tests for G1, G2 and GT on BLS pairing-friendly
+                     *     curves", https://eprint.iacr.org/2021/1130);
+                     * psi: psi(P) == [z]P with psi the untwist-Frobenius-twist endomorphism, z = u for BLS12 G2
+                     *     and z = 6u^2 for BN G2.
+                     */
+                    enum class subgroup_check_type { order, cofactor_one, sigma, psi };
+
+                    /**
+                     * @brief Constants of the subgroup membership test, keyed by the group params type.
+                     *
+                     * Specializations provide type, cofactor_min_prime_bits (floor(log2(l)) for l the smallest
+                     * prime factor of the cofactor, bounding random linear combination batches), and
+                     * omega and u for sigma, or psi_x, psi_y, z and z_is_negative for psi.
+                     */
+                    template<typename CurveParams>
+                    struct subgroup_check_params { };
+
+                    /// Membership test of the group, order unless subgroup_check_params is specialized
+                    template<typename CurveParams, typename = void>
+                    struct subgroup_check_type_of
+                        : std::integral_constant<subgroup_check_type, subgroup_check_type::order> { };
+
+                    template<typename CurveParams>
+                    struct subgroup_check_type_of<CurveParams,
+                                                  std::void_t<decltype(subgroup_check_params<CurveParams>::type)>>
+                        : std::integral_constant<subgroup_check_type, subgroup_check_params<CurveParams>::type> { };
+
+                    /**
+                     * @brief True if random linear combinations can make membership tests of many points cheaper
+                     * than testing each of them, see batch_is_in_prime_subgroup.
+                     *
+                     * A batch runs ceil(128 / cofactor_min_prime_bits) rounds of 64-bit multiexp for 128-bit
+                     * security. Below 2^8 for the smallest prime factor of the cofactor, e.g. 3 for BLS12 G1 and
+                     * 13 for BLS12-381 G2, that costs more than testing every point for any practical batch size.
+                     */
+                    template<typename CurveParams, typename = void>
+                    struct has_batch_subgroup_check : std::false_type { };
+
+                    template<typename CurveParams>
+                    struct has_batch_subgroup_check<
+                        CurveParams, std::void_t<decltype(subgroup_check_params<CurveParams>::cofactor_min_prime_bits)>>
+                        : std::integral_constant<bool,
+                                                 (subgroup_check_params<CurveParams>::cofactor_min_prime_bits >= 8)> {
+                    };
+
+                    /// sigma(X, Y, Z) = (omega * X, Y, Z)
+                    template<typename GroupValueType>
+                    GroupValueType subgroup_check_sigma(const GroupValueType &point) {
+                        typedef subgroup_check_params<typename GroupValueType::params_type> params_type;
+
+                        return GroupValueType(params_type::omega * point.X, point.Y, point.Z);
+                    }
+
+                    /// psi(X, Y, Z) = (psi_x * X^p, psi_y * Y^p, Z^p)
+                    template<typename GroupValueType>
+                    GroupValueType subgroup_check_psi(const GroupValueType &point) {
+                        typedef subgroup_check_params<typename GroupValueType::params_type> params_type;
+
+                        return GroupValueType(params_type::psi_x * point.X.Frobenius_map(1),
+                                              params_type::psi_y * point.Y.Frobenius_map(1),
+                                              point.Z.Frobenius_map(1));
+                    }
+
+                    /**
+                     * @brief Checks that a point of the curve lies in the prime order subgroup.
+                     *
+                     * The point is expected to be on the curve, see is_well_formed().
+                     */
+                    template<typename GroupValueType>
+                    bool check_prime_subgroup_membership(const GroupValueType &point) {
+                        typedef typename GroupValueType::params_type curve_params_type;
+                        typedef subgroup_check_params<curve_params_type> params_type;
+
+                        constexpr static const subgroup_check_type type =
+                            subgroup_check_type_of<curve_params_type>::value;
+
+                        if constexpr (type == subgroup_check_type::cofactor_one) {
+                            return true;
+                        } else if constexpr (type == subgroup_check_type::sigma) {
+                            const GroupValueType u_point = point * params_type::u;
+                            return subgroup_check_sigma(point) == -(u_point * params_type::u);
+                        } else if constexpr (type == subgroup_check_type::psi) {
+                            const GroupValueType z_point = point * params_type::z;
+                            return subgroup_check_psi(point) == (params_type::z_is_negative ? -z_point : z_point);
+                        } else {
+                            return (point * curve_params_type::scalar_field_type::modulus).is_zero();
+                        }
+                    }
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
     }                // namespace crypto3
 }    // namespace nil
+
 #endif    // CRYPTO3_ALGEBRA_CURVES_SUBGROUP_CHECK_HPP
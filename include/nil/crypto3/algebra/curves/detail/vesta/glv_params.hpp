@@ -0,0 +1,100 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_VESTA_GLV_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_VESTA_GLV_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/vesta/params.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+#ifdef __ZKLLVM__
+#else
+                    /**
+                     * @brief GLV constants of Vesta: beta^3 = 1 in Fq, lambda^3 = 1 in Fr, phi(P) = lambda * P.
+                     *
+                     * Short basis of the lattice {(a, b) : a + b * lambda = 0 mod r}:
+                     *  a1 = 98231058071186745657228807397848383488, b1 = -98231058071100081932162823354453065729,
+                     *  a2 = 98231058071100081932162823354453065729, b2 = 196462116142286827589391630752301449217.
+                     */
+                    template<>
+                    struct glv_params<vesta_g1_params<forms::short_weierstrass>> {
+                        using base_field_type = typename vesta_g1_params<forms::short_weierstrass>::field_type;
+                        using scalar_field_type =
+                            typename vesta_g1_params<forms::short_weierstrass>::scalar_field_type;
+                        using extended_integral_type = typename scalar_field_type::extended_integral_type;
+
+                        constexpr static const typename base_field_type::value_type beta =
+                            typename base_field_type::value_type(
+                                0x6819A58283E528E511DB4D81CF70F5A0FED467D47C033AF2AA9D2E050AA0E4F_cppui251);
+                        constexpr static const typename scalar_field_type::value_type lambda =
+                            typename scalar_field_type::value_type(
+                                0x12CCCA834ACDBA712CAAD5DC57AAB1B01D1F8BD237AD31491DAD5EBDFDFE4AB9_cppui253);
+
+                        constexpr static const std::size_t shift = 510;
+                        constexpr static const extended_integral_type g1 =
+                            0x93CD3A2C8198E2690C7C095A00000000B0D7EF5342BFA649A10763588A5B8558CED4AF59B9205E5888B1F86EF17BECD7_cppui384;
+                        constexpr static const extended_integral_type g2 =
+                            0x49E69D1640A899538CB1279300000000D86BF7A9A173055E2105053092FE66A0B2CBF4902C3998E5B3DCA1ED480F0905_cppui383;
+                        constexpr static const typename scalar_field_type::value_type minus_b1 =
+                            typename scalar_field_type::value_type(
+                                0x49E69D1640A899538CB1279300000001_cppui127);
+                        constexpr static const typename scalar_field_type::value_type minus_b2 =
+                            typename scalar_field_type::value_type(
+                                0x3FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF8E795ECF87B416B28CB1279300000000_cppui254);
+                    };
+
+                    constexpr typename glv_params<
+                        vesta_g1_params<forms::short_weierstrass>>::base_field_type::value_type const
+                        glv_params<vesta_g1_params<forms::short_weierstrass>>::beta;
+                    constexpr typename glv_params<
+                        vesta_g1_params<forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<vesta_g1_params<forms::short_weierstrass>>::lambda;
+                    constexpr std::size_t const
+                        glv_params<vesta_g1_params<forms::short_weierstrass>>::shift;
+                    constexpr typename glv_params<
+                        vesta_g1_params<forms::short_weierstrass>>::extended_integral_type const
+                        glv_params<vesta_g1_params<forms::short_weierstrass>>::g1;
+                    constexpr typename glv_params<
+                        vesta_g1_params<forms::short_weierstrass>>::extended_integral_type const
+                        glv_params<vesta_g1_params<forms::short_weierstrass>>::g2;
+                    constexpr typename glv_params<
+                        vesta_g1_params<forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<vesta_g1_params<forms::short_weierstrass>>::minus_b1;
+                    constexpr typename glv_params<
+                        vesta_g1_params<forms::short_weierstrass>>::scalar_field_type::value_type const
+                        glv_params<vesta_g1_params<forms::short_weierstrass>>::minus_b2;
+#endif
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_VESTA_GLV_PARAMS_HPP
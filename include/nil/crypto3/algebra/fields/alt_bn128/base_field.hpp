@@ -59,6 +59,10 @@ namespace nil {
                     constexpr static const integral_type modulus =
                         0x30644E72E131A029B85045B68181585D97816A916871CA8D3C208C16D87CFD47_cppui254;
 
+                    /// Modulus limbs, least significant first, enables fixed_montgomery_arithmetic
+                    constexpr static const std::array<std::uint64_t, 4> montgomery_modulus_limbs = {
+                        0x3c208c16d87cfd47, 0x97816a916871ca8d, 0xb85045b68181585d, 0x30644e72e131a029};
+
                     typedef typename policy_type::modular_backend modular_backend;
                     constexpr static const modular_params_type modulus_params = modulus;
                     typedef nil::crypto3::multiprecision::number<
@@ -82,6 +86,7 @@ namespace nil {
                 constexpr typename std::size_t const alt_bn128_base_field<254>::value_bits;
 
                 constexpr typename alt_bn128_base_field<254>::integral_type const alt_bn128_base_field<254>::modulus;
+                constexpr std::array<std::uint64_t, 4> const alt_bn128_base_field<254>::montgomery_modulus_limbs;
 
                 constexpr typename alt_bn128_base_field<254>::modular_params_type const
                     alt_bn128_base_field<254>::modulus_params;
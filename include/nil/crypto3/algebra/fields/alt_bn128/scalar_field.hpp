@@ -59,6 +59,10 @@ namespace nil {
                     constexpr static const integral_type modulus =
                         0x30644E72E131A029B85045B68181585D2833E84879B9709143E1F593F0000001_cppui254;
 
+                    /// Modulus limbs, least significant first, enables fixed_montgomery_arithmetic
+                    constexpr static const std::array<std::uint64_t, 4> montgomery_modulus_limbs = {
+                        0x43e1f593f0000001, 0x2833e84879b97091, 0xb85045b68181585d, 0x30644e72e131a029};
+
                     typedef typename policy_type::modular_backend modular_backend;
                     constexpr static const modular_params_type modulus_params = modulus;
                     typedef nil::crypto3::multiprecision::number<
@@ -83,6 +87,7 @@ namespace nil {
 
                 constexpr
                     typename alt_bn128_scalar_field<254>::integral_type const alt_bn128_scalar_field<254>::modulus;
+                constexpr std::array<std::uint64_t, 4> const alt_bn128_scalar_field<254>::montgomery_modulus_limbs;
 
                 constexpr typename alt_bn128_scalar_field<254>::modular_params_type const
                     alt_bn128_scalar_field<254>::modulus_params;
@@ -64,6 +64,11 @@ namespace nil {
                     constexpr static const integral_type modulus =
                         0x1A0111EA397FE69A4B1BA7B6434BACD764774B84F38512BF6730D2A0F6B0F6241EABFFFEB153FFFFB9FEFFFFFFFFAAAB_cppui381;
 
+                    /// Modulus limbs, least significant first, enables fixed_montgomery_arithmetic
+                    constexpr static const std::array<std::uint64_t, 6> montgomery_modulus_limbs = {
+                        0xb9feffffffffaaab, 0x1eabfffeb153ffff, 0x6730d2a0f6b0f624,
+                        0x64774b84f38512bf, 0x4b1ba7b6434bacd7, 0x1a0111ea397fe69a};
+
                     typedef typename policy_type::modular_backend modular_backend;
                     constexpr static const modular_params_type modulus_params = modulus;
                     typedef nil::crypto3::multiprecision::number<
@@ -120,6 +125,7 @@ namespace nil {
 #ifdef __ZKLLVM__
 #else
                 constexpr typename bls12_base_field<381>::integral_type const bls12_base_field<381>::modulus;
+                constexpr std::array<std::uint64_t, 6> const bls12_base_field<381>::montgomery_modulus_limbs;
                 constexpr typename bls12_base_field<377>::integral_type const bls12_base_field<377>::modulus;
 #endif
                 constexpr
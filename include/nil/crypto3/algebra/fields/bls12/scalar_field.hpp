@@ -63,6 +63,10 @@ namespace nil {
                     constexpr static const integral_type modulus =
                         0x73EDA753299D7D483339D80809A1D80553BDA402FFFE5BFEFFFFFFFF00000001_cppui255;
 
+                    /// Modulus limbs, least significant first, enables fixed_montgomery_arithmetic
+                    constexpr static const std::array<std::uint64_t, 4> montgomery_modulus_limbs = {
+                        0xffffffff00000001, 0x53bda402fffe5bfe, 0x3339d80809a1d805, 0x73eda753299d7d48};
+
                     typedef typename policy_type::modular_backend modular_backend;
                     constexpr static const modular_params_type modulus_params = modulus;
                     typedef nil::crypto3::multiprecision::number<
@@ -117,6 +121,7 @@ namespace nil {
 #ifdef __ZKLLVM__
 #else
                 constexpr typename bls12_scalar_field<381>::integral_type const bls12_scalar_field<381>::modulus;
+                constexpr std::array<std::uint64_t, 4> const bls12_scalar_field<381>::montgomery_modulus_limbs;
                 constexpr typename bls12_scalar_field<377>::integral_type const bls12_scalar_field<377>::modulus;
 #endif
                 constexpr
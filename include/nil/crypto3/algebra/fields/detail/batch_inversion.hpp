@@ -0,0 +1,139 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_BATCH_INVERSION_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_BATCH_INVERSION_HPP
+
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/algebra/parallelization.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                /**
+                 * Writes the inverses of [first, last) to out using Montgomery's trick: one field inversion
+                 * and 3(n - 1) multiplications. Zero elements are skipped and give zero. The output holds the
+                 * prefix products in between, so no other memory is used; it must not overlap the input.
+                 * Works for any field element type, extension fields included. Both iterators have to be
+                 * random access.
+                 */
+                template<typename InputIterator, typename OutputIterator>
+                OutputIterator batch_inverse(InputIterator first, InputIterator last, OutputIterator out) {
+                    typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+
+                    const std::size_t size = std::distance(first, last);
+                    if (size == 0) {
+                        return out;
+                    }
+
+                    value_type acc = value_type::one();
+                    for (std::size_t i = 0; i < size; ++i) {
+                        out[i] = acc;
+                        if (!first[i].is_zero()) {
+                            acc = acc * first[i];
+                        }
+                    }
+
+                    acc = acc.inversed();
+
+                    for (std::size_t i = size - 1; i < size; --i) {
+                        if (first[i].is_zero()) {
+                            out[i] = value_type::zero();
+                            continue;
+                        }
+                        const value_type inverse = acc * out[i];
+                        acc = acc * first[i];
+                        out[i] = inverse;
+                    }
+
+                    return out + size;
+                }
+
+                /**
+                 * Same as batch_inverse, the input is split into chunks_count slices processed through
+                 * the executor, which costs one field inversion per slice.
+                 */
+                template<typename InputIterator, typename OutputIterator, typename Executor>
+                OutputIterator batch_inverse(InputIterator first, InputIterator last, OutputIterator out,
+                                             const std::size_t chunks_count, Executor &&executor) {
+                    const std::size_t size = std::distance(first, last);
+
+                    algebra::detail::parallel_for_chunks(
+                        std::forward<Executor>(executor), size, chunks_count,
+                        [first, out](std::size_t begin, std::size_t end) {
+                            batch_inverse(first + begin, first + end, out + begin);
+                        });
+
+                    return out + size;
+                }
+
+                /// @return inverses of the elements of the range, zero for zero elements
+                template<typename InputRange>
+                std::vector<typename InputRange::value_type> batch_inverse(const InputRange &elements) {
+                    std::vector<typename InputRange::value_type> result(std::distance(elements.begin(),
+                                                                                      elements.end()));
+                    batch_inverse(elements.begin(), elements.end(), result.begin());
+                    return result;
+                }
+
+                template<typename InputRange, typename Executor>
+                std::vector<typename InputRange::value_type>
+                    batch_inverse(const InputRange &elements, const std::size_t chunks_count, Executor &&executor) {
+                    std::vector<typename InputRange::value_type> result(std::distance(elements.begin(),
+                                                                                      elements.end()));
+                    batch_inverse(elements.begin(), elements.end(), result.begin(), chunks_count,
+                                  std::forward<Executor>(executor));
+                    return result;
+                }
+
+                namespace detail {
+                    /**
+                     * Replaces every element of the vector by its inverse, see batch_inverse. All the elements
+                     * must be non-zero. prefix_products is a scratch buffer, so that repeated calls do not
+                     * reallocate.
+                     */
+                    template<typename FieldValueType>
+                    void batch_invert_non_zeros(std::vector<FieldValueType> &elements,
+                                                std::vector<FieldValueType> &prefix_products) {
+                        prefix_products.resize(elements.size());
+                        batch_inverse(elements.begin(), elements.end(), prefix_products.begin());
+                        elements.swap(prefix_products);
+                    }
+
+                    template<typename FieldValueType>
+                    void batch_invert_non_zeros(std::vector<FieldValueType> &elements) {
+                        std::vector<FieldValueType> prefix_products;
+                        batch_invert_non_zeros(elements, prefix_products);
+                    }
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_BATCH_INVERSION_HPP
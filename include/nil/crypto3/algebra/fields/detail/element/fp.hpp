@@ -27,6 +27,8 @@
 #define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_HPP
 
 #include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
+#include <nil/crypto3/algebra/fields/detail/montgomery_arithmetic.hpp>
+#include <nil/crypto3/algebra/fields/detail/safegcd_inversion.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/operations.hpp>
 
 #include <nil/crypto3/multiprecision/ressol.hpp>
@@ -37,6 +39,7 @@
 
 #include <boost/type_traits/is_integral.hpp>
 
+#include <array>
 #include <type_traits>
 
 namespace nil {
@@ -44,6 +47,9 @@ namespace nil {
         namespace algebra {
             namespace fields {
                 namespace detail {
+                    template<typename FieldParams>
+                    class element_fp_unreduced;
+
                     template<typename FieldParams>
                     class element_fp {
                         typedef FieldParams policy_type;
@@ -59,6 +65,14 @@ namespace nil {
                         constexpr static const modular_params_type modulus_params = policy_type::modulus_params;
                         constexpr static const integral_type modulus = policy_type::modulus;
 
+                        /// Multiplications go through fixed_montgomery_arithmetic if the field provides its limbs
+                        constexpr static const bool is_fixed_montgomery = is_fixed_montgomery_field<field_type>::value;
+
+                        /// Products may be accumulated as element_fp_unreduced and reduced once
+                        constexpr static const bool lazy_reduction = is_lazy_reduction_field<field_type>::value;
+
+                        typedef element_fp_unreduced<FieldParams> unreduced_type;
+
                         using data_type = modular_type;
                         data_type data;
 
@@ -73,9 +87,7 @@ namespace nil {
                                                          bool>::type = true>
                         constexpr element_fp(const Number &data) : data(data, modulus_params) {};
 
-                        constexpr element_fp(const element_fp &B) {
-                            data = B.data;
-                        };
+                        constexpr element_fp(const element_fp &B) = default;
 
                         constexpr inline static element_fp zero() {
                             return element_fp(0);
@@ -101,10 +113,42 @@ namespace nil {
                             return data != B.data;
                         }
 
-                        constexpr element_fp &operator=(const element_fp &B) {
-                            data = B.data;
-
-                            return *this;
+                        constexpr element_fp &operator=(const element_fp &B) = default;
+
+                        /// *this = flag ? B : *this, masking the limbs of the Montgomery form instead of branching
+                        constexpr void conditional_assign(const element_fp &B, bool flag) {
+                            typedef multiprecision::limb_type limb_type;
+                            const limb_type mask = limb_type(0) - limb_type(flag);
+
+                            if constexpr (is_fixed_montgomery) {
+                                const montgomery_limbs_ref<field_type> a(data), b(B.data);
+
+                                write_montgomery_limbs<field_type>(data, [&](limb_type *result) {
+                                    for (std::size_t i = 0; i < fixed_montgomery_arithmetic<field_type>::limbs_count;
+                                         ++i) {
+                                        result[i] = a.data()[i] ^ (mask & (a.data()[i] ^ b.data()[i]));
+                                    }
+                                });
+                            } else {
+                                constexpr const std::size_t limbs_count =
+                                    (field_type::modulus_bits + 8 * sizeof(limb_type) - 1) / (8 * sizeof(limb_type));
+                                auto &a = data.backend().base_data();
+                                const auto &b = B.data.backend().base_data();
+
+                                std::array<limb_type, limbs_count> a_limbs = {}, b_limbs = {};
+                                for (std::size_t i = 0; i < a.size(); ++i) {
+                                    a_limbs[i] = a.limbs()[i];
+                                }
+                                for (std::size_t i = 0; i < b.size(); ++i) {
+                                    b_limbs[i] = b.limbs()[i];
+                                }
+
+                                a.resize(limbs_count, limbs_count);
+                                for (std::size_t i = 0; i < limbs_count; ++i) {
+                                    a.limbs()[i] = a_limbs[i] ^ (mask & (a_limbs[i] ^ b_limbs[i]));
+                                }
+                                a.normalize();
+                            }
                         }
 
                         constexpr element_fp operator+(const element_fp &B) const {
@@ -128,15 +172,17 @@ namespace nil {
                         }
 
                         constexpr element_fp &operator*=(const element_fp &B) {
-                            data *= B.data;
+                            if constexpr (is_fixed_montgomery) {
+                                fixed_montgomery_mul<field_type>(data, data, B.data);
+                            } else {
+                                data *= B.data;
+                            }
 
                             return *this;
                         }
 
                         constexpr element_fp &operator/=(const element_fp &B) {
-                            data *= B.inversed().data;
-
-                            return *this;
+                            return *this *= B.inversed();
                         }
 
                         constexpr element_fp operator-() const {
@@ -144,12 +190,23 @@ namespace nil {
                         }
 
                         constexpr element_fp operator*(const element_fp &B) const {
-                            return element_fp(data * B.data);
+                            if constexpr (is_fixed_montgomery) {
+                                element_fp result;
+                                fixed_montgomery_mul<field_type>(result.data, data, B.data);
+                                return result;
+                            } else {
+                                return element_fp(data * B.data);
+                            }
+                        }
+
+                        /// Product without the final Montgomery reduction, available if lazy_reduction is set
+                        constexpr unreduced_type mul_unreduced(const element_fp &B) const {
+                            return unreduced_type::product(*this, B);
                         }
 
                         constexpr element_fp operator/(const element_fp &B) const {
                             //                        return element_fp(data / B.data);
-                            return element_fp(data * B.inversed().data);
+                            return *this * B.inversed();
                         }
 
                         constexpr bool operator<(const element_fp &B) const {
@@ -199,8 +256,22 @@ namespace nil {
                             return element_fp(ressol(data));
                         }
 
+                        /// Runs in constant time for fields satisfying is_fixed_montgomery, see safegcd_inversion
                         constexpr element_fp inversed() const {
-                            return element_fp(inverse_mod(data));
+                            if constexpr (is_fixed_montgomery) {
+                                return safegcd_inversed<false>();
+                            } else {
+                                return element_fp(inverse_mod(data));
+                            }
+                        }
+
+                        /// Faster inversion whose running time depends on the value, for public values only
+                        constexpr element_fp inversed_vartime() const {
+                            if constexpr (is_fixed_montgomery) {
+                                return safegcd_inversed<true>();
+                            } else {
+                                return element_fp(inverse_mod(data));
+                            }
                         }
 
                         // TODO: complete method
@@ -208,12 +279,18 @@ namespace nil {
                         }
 
                         constexpr element_fp squared() const {
-                            return element_fp(data * data);    // maybe can be done more effective
+                            return *this * *this;    // maybe can be done more effective
                         }
 
-                        // TODO: maybe error here
                         constexpr bool is_square() const {
-                            return (this->sqrt() != -1);    // maybe can be done more effective
+                            if constexpr (is_fixed_montgomery) {
+                                typename safegcd_inversion<field_type>::limbs_type a;
+                                load_montgomery_limbs<field_type>(a, data);
+                                return safegcd_inversion<field_type>::legendre_symbol(a) >= 0;
+                            } else {
+                                // TODO: maybe error here
+                                return (this->sqrt() != -1);    // maybe can be done more effective
+                            }
                         }
 
                         template<typename PowerType,
@@ -227,6 +304,102 @@ namespace nil {
                             pow(const multiprecision::number<Backend, ExpressionTemplates> &pwr) const {
                             return element_fp(multiprecision::powm(data, pwr));
                         }
+
+                    private:
+                        template<bool Vartime>
+                        constexpr element_fp safegcd_inversed() const {
+                            typename safegcd_inversion<field_type>::limbs_type a, result;
+                            load_montgomery_limbs<field_type>(a, data);
+                            if constexpr (Vartime) {
+                                safegcd_inversion<field_type>::inverse_vartime(result, a);
+                            } else {
+                                safegcd_inversion<field_type>::inverse(result, a);
+                            }
+
+                            element_fp inverse;
+                            store_montgomery_limbs<field_type>(inverse.data, result);
+                            return inverse;
+                        }
+                    };
+
+                    /**
+                     * Double-width product of Fp elements kept modulo p * R. Sums and differences of
+                     * such products are reduced once by reduced() instead of once per product.
+                     */
+                    template<typename FieldParams>
+                    class element_fp_unreduced {
+                        typedef typename FieldParams::field_type field_type;
+                        typedef fixed_montgomery_arithmetic<field_type> arithmetic_type;
+
+                        static_assert(is_lazy_reduction_field<field_type>::value,
+                                      "Lazy reduction requires a fixed Montgomery field with a spare modulus bit");
+
+                    public:
+                        typedef element_fp<FieldParams> reduced_type;
+
+                        using data_type = typename arithmetic_type::wide_limbs_type;
+                        data_type data;
+
+                        constexpr element_fp_unreduced() : data {} {};
+
+                        constexpr static element_fp_unreduced product(const reduced_type &A, const reduced_type &B) {
+                            const montgomery_limbs_ref<field_type> a(A.data), b(B.data);
+
+                            element_fp_unreduced result;
+                            arithmetic_type::mul_wide(result.data, a.data(), b.data());
+                            return result;
+                        }
+
+                        constexpr element_fp_unreduced operator+(const element_fp_unreduced &B) const {
+                            element_fp_unreduced result;
+                            arithmetic_type::add_wide(result.data, data, B.data);
+                            return result;
+                        }
+
+                        constexpr element_fp_unreduced operator-(const element_fp_unreduced &B) const {
+                            element_fp_unreduced result;
+                            arithmetic_type::sub_wide(result.data, data, B.data);
+                            return result;
+                        }
+
+                        constexpr element_fp_unreduced &operator+=(const element_fp_unreduced &B) {
+                            arithmetic_type::add_wide(data, data, B.data);
+                            return *this;
+                        }
+
+                        constexpr element_fp_unreduced &operator-=(const element_fp_unreduced &B) {
+                            arithmetic_type::sub_wide(data, data, B.data);
+                            return *this;
+                        }
+
+                        constexpr element_fp_unreduced operator-() const {
+                            return element_fp_unreduced() - *this;
+                        }
+
+                        constexpr element_fp_unreduced doubled() const {
+                            return *this + *this;
+                        }
+
+                        /// Multiplication by a small non-negative integer, e.g. a non-residue coefficient
+                        constexpr element_fp_unreduced scaled(std::size_t k) const {
+                            element_fp_unreduced result, base = *this;
+                            while (k != 0) {
+                                if (k & 1) {
+                                    result += base;
+                                }
+                                base += base;
+                                k >>= 1;
+                            }
+                            return result;
+                        }
+
+                        constexpr reduced_type reduced() const {
+                            reduced_type result;
+                            write_montgomery_limbs<field_type>(
+                                result.data,
+                                [this](typename arithmetic_type::limb_type *r) { arithmetic_type::reduce(r, data); });
+                            return result;
+                        }
                     };
 
                     template<typename FieldParams>
@@ -26,7 +26,12 @@
 #ifndef CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP12_2OVER3OVER2_HPP
 #define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP12_2OVER3OVER2_HPP
 
+#include <array>
+#include <iterator>
+#include <vector>
+
 #include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
+#include <nil/crypto3/algebra/fields/detail/batch_inversion.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/operations.hpp>
 
 #include <nil/crypto3/multiprecision/number.hpp>
@@ -53,6 +58,9 @@ namespace nil {
 
                         data_type data;
 
+                        /// Products are reduced once per Fp coefficient, see element_fp6_3over2_unreduced
+                        constexpr static const bool lazy_reduction = underlying_type::lazy_reduction;
+
                         element_fp12_2over3over2() {
                             data = data_type({underlying_type::zero(), underlying_type::zero()});
                         }
@@ -90,6 +98,13 @@ namespace nil {
                             return *this;
                         }
 
+                        /// *this = flag ? B : *this, coefficient by coefficient without branching on flag
+                        void conditional_assign(const element_fp12_2over3over2 &B, bool flag) {
+                            for (std::size_t i = 0; i < data.size(); ++i) {
+                                data[i].conditional_assign(B.data[i], flag);
+                            }
+                        }
+
                         element_fp12_2over3over2 operator+(const element_fp12_2over3over2 &B) const {
                             return element_fp12_2over3over2(data[0] + B.data[0], data[1] + B.data[1]);
                         }
@@ -121,6 +136,16 @@ namespace nil {
                         }
 
                         element_fp12_2over3over2 operator*(const element_fp12_2over3over2 &B) const {
+                            if constexpr (lazy_reduction) {
+                                const underlying_type &A0 = data[0], &A1 = data[1], &B0 = B.data[0], &B1 = B.data[1];
+                                const typename underlying_type::unreduced_type A0B0 = A0.mul_unreduced(B0),
+                                                                               A1B1 = A1.mul_unreduced(B1);
+
+                                return element_fp12_2over3over2(
+                                    (A0B0 + A1B1.mul_by_non_residue()).reduced(),
+                                    ((A0 + A1).mul_unreduced(B0 + B1) - A0B0 - A1B1).reduced());
+                            }
+
                             const underlying_type A0B0 = data[0] * B.data[0], A1B1 = data[1] * B.data[1];
 
                             return element_fp12_2over3over2(A0B0 + mul_by_non_residue(A1B1),
@@ -134,6 +159,18 @@ namespace nil {
                         }
 
                         element_fp12_2over3over2 squared() const {
+                            if constexpr (lazy_reduction) {
+                                /* Devegili OhEig Scott Dahab --- Multiplication and Squaring on Pairing-Friendly
+                                 * Fields.pdf; Section 3 (Complex squaring) */
+                                const underlying_type &A0 = data[0], &A1 = data[1];
+                                const typename underlying_type::unreduced_type A0A1 = A0.mul_unreduced(A1);
+
+                                return element_fp12_2over3over2(
+                                    ((A0 + A1).mul_unreduced(A0 + mul_by_non_residue(A1)) - A0A1 -
+                                     A0A1.mul_by_non_residue())
+                                        .reduced(),
+                                    A0A1.doubled().reduced());
+                            }
 
                             return (*this) * (*this);    // maybe can be done more effective
                         }
@@ -245,79 +282,201 @@ namespace nil {
                             return element_fp12_2over3over2(underlying_type(z0, z4, z3), underlying_type(z2, z1, z5));
                         }
 
+                        /**
+                         * @brief Karabina's compressed squaring in the cyclotomic subgroup.
+                         *
+                         * Only g1 = data[0].data[1], g2 = data[0].data[2], g3 = data[1].data[0] and
+                         * g5 = data[1].data[2] are computed, g0 and g4 are set to zero and have to be recovered by
+                         * decompressed() or batch_decompress() before the element is used otherwise.
+                         */
+                        element_fp12_2over3over2 cyclotomic_squared_compressed() const {
+                            typedef typename underlying_type::underlying_type underlying_underlying_type;
+
+                            const underlying_underlying_type &g1 = data[0].data[1], &g2 = data[0].data[2],
+                                                             &g3 = data[1].data[0], &g5 = data[1].data[2];
+
+                            const underlying_underlying_type g1_squared = g1.squared(), g2_squared = g2.squared(),
+                                                             g3_squared = g3.squared(), g5_squared = g5.squared();
+
+                            // A = g1^2 + xi * g5^2, B = g3^2 + xi * g2^2
+                            const underlying_underlying_type A = g1_squared + underlying_type::non_residue * g5_squared;
+                            const underlying_underlying_type B = g3_squared + underlying_type::non_residue * g2_squared;
+                            // C = 2 * xi * g1 * g5, D = 2 * g2 * g3
+                            const underlying_underlying_type C =
+                                underlying_type::non_residue * ((g1 + g5).squared() - g1_squared - g5_squared);
+                            const underlying_underlying_type D = (g2 + g3).squared() - g2_squared - g3_squared;
+
+                            return element_fp12_2over3over2(
+                                underlying_type(underlying_underlying_type::zero(),
+                                                (B - g1).doubled() + B,     // 3 * B - 2 * g1
+                                                (A - g2).doubled() + A),    // 3 * A - 2 * g2
+                                underlying_type((C + g3).doubled() + C,     // 3 * C + 2 * g3
+                                                underlying_underlying_type::zero(),
+                                                (D + g5).doubled() + D));    // 3 * D + 2 * g5
+                        }
+
+                        /**
+                         * @brief Recovers g0 and g4 of the compressed elements, see cyclotomic_squared_compressed.
+                         * Inversions of all the elements are shared.
+                         */
+                        static void batch_decompress(std::vector<element_fp12_2over3over2> &elements) {
+                            typedef typename underlying_type::underlying_type underlying_underlying_type;
+
+                            std::vector<underlying_underlying_type> numerators(elements.size()),
+                                denominators(elements.size()), inverses(elements.size());
+                            batch_decompress(elements.begin(), elements.end(), numerators.begin(),
+                                             denominators.begin(), inverses.begin());
+                        }
+
+                        element_fp12_2over3over2 decompressed() const {
+                            typedef typename underlying_type::underlying_type underlying_underlying_type;
+
+                            std::array<element_fp12_2over3over2, 1> elements = {*this};
+                            std::array<underlying_underlying_type, 1> numerators, denominators, inverses;
+                            batch_decompress(elements.begin(), elements.end(), numerators.begin(),
+                                             denominators.begin(), inverses.begin());
+
+                            return elements[0];
+                        }
+
+                        /**
+                         * @brief Exponentiation in the cyclotomic subgroup.
+                         *
+                         * The base is squared in compressed form, the powers this^(2^i) for the set bits i are
+                         * decompressed in windows of compressed_powers_window, so the cost is msb(exponent)
+                         * compressed squarings, one batch decompression per window and popcount(exponent) - 1
+                         * multiplications.
+                         */
                         template<typename PowerType>
                         element_fp12_2over3over2 cyclotomic_exp(const PowerType &exponent) const {
-                            element_fp12_2over3over2 res = one();
-
                             if (exponent == 0)
-                                return res;
-
-                            bool found_one = false;
-                            for (long i = nil::crypto3::multiprecision::msb(exponent); i >= 0; --i) {
-                                if (found_one) {
-                                    res = res.cyclotomic_squared();
-                                }
+                                return one();
 
-                                if (nil::crypto3::multiprecision::bit_test(exponent, i)) {
-                                    found_one = true;
-                                    res = res * (*this);
-                                }
-                            }
+                            return compressed_powers_product(
+                                nil::crypto3::multiprecision::msb(exponent) + 1, [&exponent](std::size_t i) {
+                                    return nil::crypto3::multiprecision::bit_test(exponent, i) ? 1L : 0L;
+                                });
+                        }
 
-                            return res;
-                            // return *this;
+                        /**
+                         * @brief Exponentiation in the cyclotomic subgroup by a signed binary exponent
+                         * sum(naf[i] * 2^i), naf[i] in {-1, 0, 1}, e.g. given by multiprecision::find_wnaf(1, e).
+                         * Negative digits are free as inversion in the cyclotomic subgroup is conjugation.
+                         */
+                        element_fp12_2over3over2 cyclotomic_exp_naf(const std::vector<long> &naf) const {
+                            return compressed_powers_product(naf.size(), [&naf](std::size_t i) { return naf[i]; });
                         }
 
+                        /**
+                         * @brief Multiplication by a line of M-type twist,
+                         * (ell_VW, 0, 0) + (0, ell_0, ell_VV) * w, using 14 Fp2 multiplications.
+                         */
                         element_fp12_2over3over2
                             mul_by_045(const typename underlying_type::underlying_type &ell_0,
                                        const typename underlying_type::underlying_type &ell_VW,
                                        const typename underlying_type::underlying_type &ell_VV) const {
 
-                            // element_fp12_2over3over2 a(
-                            //     underlying_type(ell_VW, underlying_type::underlying_type::zero(),
-                            //                     underlying_type::underlying_type::zero()),
-                            //     underlying_type(underlying_type::underlying_type::zero(), ell_0, ell_VV));
-                            //
-                            // return (*this) * a;
+                            const underlying_type A = ell_VW * data[0];
+                            const underlying_type B = data[1].mul_by_12(ell_0, ell_VV);
 
-                            typename underlying_type::underlying_type z0 = this->data[0].data[0];
-                            typename underlying_type::underlying_type z1 = this->data[0].data[1];
-                            typename underlying_type::underlying_type z2 = this->data[0].data[2];
-                            typename underlying_type::underlying_type z3 = this->data[1].data[0];
-                            typename underlying_type::underlying_type z4 = this->data[1].data[1];
-                            typename underlying_type::underlying_type z5 = this->data[1].data[2];
+                            return element_fp12_2over3over2(
+                                A + mul_by_non_residue(B),
+                                (data[0] + data[1]) * underlying_type(ell_VW, ell_0, ell_VV) - A - B);
+                        }
 
-                            typename underlying_type::underlying_type x0 = ell_VW;
-                            typename underlying_type::underlying_type x4 = ell_0;
-                            typename underlying_type::underlying_type x5 = ell_VV;
+                        /**
+                         * @brief Multiplication by a line of D-type twist,
+                         * (ell_0, 0, ell_VV) + (0, ell_VW, 0) * w, using 14 Fp2 multiplications.
+                         */
+                        element_fp12_2over3over2
+                            mul_by_024(const typename underlying_type::underlying_type &ell_0,
+                                       const typename underlying_type::underlying_type &ell_VW,
+                                       const typename underlying_type::underlying_type &ell_VV) const {
 
-                            typename underlying_type::underlying_type t0, t1, t2, t3, t4, t5;
-                            typename underlying_type::underlying_type tmp1, tmp2;
+                            const underlying_type A = data[0].mul_by_02(ell_0, ell_VV);
+                            const underlying_type B = data[1].mul_by_1(ell_VW);
 
-                            // TODO: non_residue should be used as static
-                            tmp1 = element_fp12_2over3over2().non_residue * x4;
-                            tmp2 = element_fp12_2over3over2().non_residue * x5;
+                            return element_fp12_2over3over2(
+                                A + mul_by_non_residue(B),
+                                (data[0] + data[1]) * underlying_type(ell_0, ell_VW, ell_VV) - A - B);
+                        }
+
+                        /**
+                         * @brief Multiplication by an element with zero coefficient at w,
+                         * e.g. a product of two M-type lines, using 17 Fp2 multiplications.
+                         */
+                        element_fp12_2over3over2 mul_by_01245(const element_fp12_2over3over2 &B) const {
+                            const underlying_type A0B0 = data[0] * B.data[0];
+                            const underlying_type A1B1 = data[1].mul_by_12(B.data[1].data[1], B.data[1].data[2]);
+
+                            return element_fp12_2over3over2(A0B0 + mul_by_non_residue(A1B1),
+                                                            (data[0] + data[1]) * (B.data[0] + B.data[1]) - A0B0 -
+                                                                A1B1);
+                        }
 
-                            t0 = x0 * z0 + tmp1 * z4 + tmp2 * z3;
-                            t1 = x0 * z1 + tmp1 * z5 + tmp2 * z4;
-                            t2 = x0 * z2 + x4 * z3 + tmp2 * z5;
-                            t3 = x0 * z3 + tmp1 * z2 + tmp2 * z1;
-                            t4 = x0 * z4 + x4 * z0 + tmp2 * z2;
-                            t5 = x0 * z5 + x4 * z1 + x5 * z0;
+                        /**
+                         * @brief Multiplication by an element with zero coefficient at v^2 * w,
+                         * e.g. a product of two D-type lines, using 17 Fp2 multiplications.
+                         */
+                        element_fp12_2over3over2 mul_by_01234(const element_fp12_2over3over2 &B) const {
+                            const underlying_type A0B0 = data[0] * B.data[0];
+                            const underlying_type A1B1 = data[1].mul_by_01(B.data[1].data[0], B.data[1].data[1]);
 
-                            return element_fp12_2over3over2(underlying_type(t0, t1, t2), underlying_type(t3, t4, t5));
+                            return element_fp12_2over3over2(A0B0 + mul_by_non_residue(A1B1),
+                                                            (data[0] + data[1]) * (B.data[0] + B.data[1]) - A0B0 -
+                                                                A1B1);
                         }
 
-                        element_fp12_2over3over2
-                            mul_by_024(const typename underlying_type::underlying_type &ell_0,
-                                       const typename underlying_type::underlying_type &ell_VW,
-                                       const typename underlying_type::underlying_type &ell_VV) const {
-                            element_fp12_2over3over2 a(
-                                underlying_type(ell_0, underlying_type::underlying_type::zero(), ell_VV),
-                                underlying_type(underlying_type::underlying_type::zero(), ell_VW,
-                                                underlying_type::underlying_type::zero()));
+                        /**
+                         * @brief Product of two M-type lines, see mul_by_045, using 6 Fp2 multiplications.
+                         * The result has zero coefficient at w and is meant for mul_by_01245.
+                         */
+                        static element_fp12_2over3over2
+                            mul_045_by_045(const typename underlying_type::underlying_type &x_ell_0,
+                                           const typename underlying_type::underlying_type &x_ell_VW,
+                                           const typename underlying_type::underlying_type &x_ell_VV,
+                                           const typename underlying_type::underlying_type &y_ell_0,
+                                           const typename underlying_type::underlying_type &y_ell_VW,
+                                           const typename underlying_type::underlying_type &y_ell_VV) {
+                            typedef typename underlying_type::underlying_type underlying_underlying_type;
+
+                            const underlying_underlying_type t0 = x_ell_VW * y_ell_VW;
+                            const underlying_underlying_type t4 = x_ell_0 * y_ell_0;
+                            const underlying_underlying_type t5 = x_ell_VV * y_ell_VV;
+
+                            return element_fp12_2over3over2(
+                                underlying_type(
+                                    t0 + non_residue * t4,
+                                    non_residue * ((x_ell_0 + x_ell_VV) * (y_ell_0 + y_ell_VV) - t4 - t5),
+                                    non_residue * t5),
+                                underlying_type(underlying_underlying_type::zero(),
+                                                (x_ell_VW + x_ell_0) * (y_ell_VW + y_ell_0) - t0 - t4,
+                                                (x_ell_VW + x_ell_VV) * (y_ell_VW + y_ell_VV) - t0 - t5));
+                        }
 
-                            return (*this) * a;
+                        /**
+                         * @brief Product of two D-type lines, see mul_by_024, using 6 Fp2 multiplications.
+                         * The result has zero coefficient at v^2 * w and is meant for mul_by_01234.
+                         */
+                        static element_fp12_2over3over2
+                            mul_024_by_024(const typename underlying_type::underlying_type &x_ell_0,
+                                           const typename underlying_type::underlying_type &x_ell_VW,
+                                           const typename underlying_type::underlying_type &x_ell_VV,
+                                           const typename underlying_type::underlying_type &y_ell_0,
+                                           const typename underlying_type::underlying_type &y_ell_VW,
+                                           const typename underlying_type::underlying_type &y_ell_VV) {
+                            typedef typename underlying_type::underlying_type underlying_underlying_type;
+
+                            const underlying_underlying_type t0 = x_ell_0 * y_ell_0;
+                            const underlying_underlying_type t2 = x_ell_VV * y_ell_VV;
+                            const underlying_underlying_type t4 = x_ell_VW * y_ell_VW;
+
+                            return element_fp12_2over3over2(
+                                underlying_type(t0 + non_residue * t4, non_residue * t2,
+                                                (x_ell_0 + x_ell_VV) * (y_ell_0 + y_ell_VV) - t0 - t2),
+                                underlying_type(non_residue * ((x_ell_VV + x_ell_VW) * (y_ell_VV + y_ell_VW) - t2 - t4),
+                                                (x_ell_0 + x_ell_VW) * (y_ell_0 + y_ell_VW) - t0 - t4,
+                                                underlying_underlying_type::zero()));
                         }
 
                         /*element_fp12_2over3over2 sqru() {
@@ -358,6 +517,107 @@ namespace nil {
                         /*inline static*/ underlying_type mul_by_non_residue(const underlying_type &A) const {
                             return underlying_type(non_residue * A.data[2], A.data[0], A.data[1]);
                         }
+
+                    private:
+                        /// Number of compressed powers decompressed together, sharing one inversion
+                        constexpr static const std::size_t compressed_powers_window = 8;
+
+                        /**
+                         * Recovers g0 and g4 of the compressed elements [first, last), the scratch buffers hold
+                         * last - first Fp2 elements each.
+                         */
+                        template<typename Iterator, typename ScratchIterator>
+                        static void batch_decompress(Iterator first, Iterator last, ScratchIterator numerators,
+                                                     ScratchIterator denominators, ScratchIterator inverses) {
+                            typedef typename underlying_type::underlying_type underlying_underlying_type;
+
+                            const std::size_t size = std::distance(first, last);
+                            for (std::size_t i = 0; i < size; ++i) {
+                                const underlying_underlying_type &g1 = first[i].data[0].data[1],
+                                                                 &g2 = first[i].data[0].data[2],
+                                                                 &g3 = first[i].data[1].data[0],
+                                                                 &g5 = first[i].data[1].data[2];
+
+                                if (!g3.is_zero()) {
+                                    // g4 = (xi * g5^2 + 3 * g1^2 - 2 * g2) / (4 * g3)
+                                    const underlying_underlying_type g1_squared = g1.squared();
+                                    numerators[i] = underlying_type::non_residue * g5.squared() +
+                                                    (g1_squared - g2).doubled() + g1_squared;
+                                    denominators[i] = g3.doubled().doubled();
+                                } else {
+                                    // g4 = 2 * g1 * g5 / g2, the denominator is zero for the identity
+                                    numerators[i] = (g1 * g5).doubled();
+                                    denominators[i] = g2;
+                                }
+                            }
+
+                            fields::batch_inverse(denominators, denominators + size, inverses);
+
+                            for (std::size_t i = 0; i < size; ++i) {
+                                element_fp12_2over3over2 &element = first[i];
+                                const underlying_underlying_type &g1 = element.data[0].data[1],
+                                                                 &g2 = element.data[0].data[2],
+                                                                 &g3 = element.data[1].data[0],
+                                                                 &g5 = element.data[1].data[2];
+
+                                if (g3.is_zero() && g2.is_zero()) {
+                                    // g1 = g2 = g3 = g5 = 0 only for the identity
+                                    element = one();
+                                    continue;
+                                }
+
+                                const underlying_underlying_type g4 = numerators[i] * inverses[i];
+
+                                // g0 = xi * (2 * g4^2 + g3 * g5 - 3 * g1 * g2) + 1
+                                const underlying_underlying_type g1g2 = g1 * g2;
+                                element.data[0].data[0] =
+                                    underlying_type::non_residue * ((g4.squared() - g1g2).doubled() + g3 * g5 - g1g2) +
+                                    underlying_underlying_type::one();
+                                element.data[1].data[1] = g4;
+                            }
+                        }
+
+                        /**
+                         * Product of this^(digit(i) * 2^i) for i < digits_count, digit(i) in {-1, 0, 1}. The
+                         * powers are kept compressed and decompressed once compressed_powers_window of them
+                         * are collected.
+                         */
+                        template<typename DigitFunction>
+                        element_fp12_2over3over2 compressed_powers_product(std::size_t digits_count,
+                                                                           DigitFunction &&digit) const {
+                            typedef typename underlying_type::underlying_type underlying_underlying_type;
+
+                            std::array<element_fp12_2over3over2, compressed_powers_window> powers;
+                            std::array<underlying_underlying_type, compressed_powers_window> numerators,
+                                denominators, inverses;
+                            std::size_t powers_count = 0;
+
+                            element_fp12_2over3over2 result = one(), base = *this;
+                            bool result_is_one = true;
+                            for (std::size_t i = 0; i < digits_count; ++i) {
+                                if (i > 0) {
+                                    base = base.cyclotomic_squared_compressed();
+                                }
+
+                                const long d = digit(i);
+                                if (d != 0) {
+                                    powers[powers_count++] = d > 0 ? base : base.unitary_inversed();
+                                }
+
+                                if (powers_count == compressed_powers_window ||
+                                    (powers_count != 0 && i + 1 == digits_count)) {
+                                    batch_decompress(powers.begin(), powers.begin() + powers_count,
+                                                     numerators.begin(), denominators.begin(), inverses.begin());
+                                    for (std::size_t k = 0; k < powers_count; ++k) {
+                                        result = result_is_one ? powers[k] : result * powers[k];
+                                        result_is_one = false;
+                                    }
+                                    powers_count = 0;
+                                }
+                            }
+
+                            return result;
+                        }
                     };
 
                     template<typename FieldParams>
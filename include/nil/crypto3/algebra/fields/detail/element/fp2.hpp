@@ -35,6 +35,9 @@ namespace nil {
             namespace fields {
                 namespace detail {
 
+                    template<typename FieldParams>
+                    class element_fp2_unreduced;
+
                     template<typename FieldParams>
                     class element_fp2 {
                         typedef FieldParams policy_type;
@@ -55,6 +58,12 @@ namespace nil {
 
                         data_type data;
 
+                        /// Products are reduced once per coefficient, see element_fp2_unreduced
+                        constexpr static const bool lazy_reduction =
+                            underlying_type::lazy_reduction && has_small_non_residue<policy_type>::value;
+
+                        typedef element_fp2_unreduced<FieldParams> unreduced_type;
+
                         constexpr element_fp2() {
                             data = data_type({underlying_type::zero(), underlying_type::zero()});
                         }
@@ -72,7 +81,7 @@ namespace nil {
                             data = data_type({in_data0, in_data1});
                         }
 
-                        constexpr element_fp2(const element_fp2 &B) : data {B.data} {};
+                        constexpr element_fp2(const element_fp2 &B) = default;
 
                         constexpr inline static element_fp2 zero() {
                             return element_fp2(underlying_type::zero(), underlying_type::zero());
@@ -98,11 +107,13 @@ namespace nil {
                             return (data[0] != B.data[0]) || (data[1] != B.data[1]);
                         }
 
-                        constexpr element_fp2 &operator=(const element_fp2 &B) {
-                            data[0] = B.data[0];
-                            data[1] = B.data[1];
+                        constexpr element_fp2 &operator=(const element_fp2 &B) = default;
 
-                            return *this;
+                        /// *this = flag ? B : *this, coefficient by coefficient without branching on flag
+                        constexpr void conditional_assign(const element_fp2 &B, bool flag) {
+                            for (std::size_t i = 0; i < data.size(); ++i) {
+                                data[i].conditional_assign(B.data[i], flag);
+                            }
                         }
 
                         constexpr element_fp2 operator+(const element_fp2 &B) const {
@@ -132,6 +143,10 @@ namespace nil {
                         }
 
                         constexpr element_fp2 operator*(const element_fp2 &B) const {
+                            if constexpr (lazy_reduction) {
+                                return mul_unreduced(B).reduced();
+                            }
+
                             // TODO: the use of data and B.data directly in return statement addition cause constexpr
                             // error for gcc
                             const underlying_type A0 = data[0], A1 = data[1], B0 = B.data[0], B1 = B.data[1];
@@ -140,6 +155,17 @@ namespace nil {
                             return element_fp2(A0B0 + non_residue * A1B1, (A0 + A1) * (B0 + B1) - A0B0 - A1B1);
                         }
 
+                        /// Karatsuba product with both coefficients left unreduced
+                        constexpr unreduced_type mul_unreduced(const element_fp2 &B) const {
+                            const underlying_type &A0 = data[0], &A1 = data[1], &B0 = B.data[0], &B1 = B.data[1];
+                            const typename underlying_type::unreduced_type A0B0 = A0.mul_unreduced(B0),
+                                                                           A1B1 = A1.mul_unreduced(B1);
+
+                            return unreduced_type(
+                                A0B0 + unreduced_type::mul_by_integral(A1B1, policy_type::small_non_residue),
+                                (A0 + A1).mul_unreduced(B0 + B1) - A0B0 - A1B1);
+                        }
+
                         constexpr element_fp2 &operator*=(const element_fp2 &B) {
                             *this = *this * B;
 
@@ -247,6 +273,17 @@ namespace nil {
 
                             /* Devegili OhEig Scott Dahab --- Multiplication and Squaring on Pairing-Friendly
                              * Fields.pdf; Section 3 (Complex squaring) */
+                            if constexpr (lazy_reduction) {
+                                const underlying_type &A = data[0], &B = data[1];
+
+                                return unreduced_type(
+                                           A.mul_unreduced(A) +
+                                               unreduced_type::mul_by_integral(B.mul_unreduced(B),
+                                                                               policy_type::small_non_residue),
+                                           A.mul_unreduced(B).doubled())
+                                    .reduced();
+                            }
+
                             // TODO: reference here could cause error in constexpr for gcc
                             const underlying_type A = data[0], B = data[1];
                             const underlying_type AB = A * B;
@@ -255,8 +292,23 @@ namespace nil {
                         }
 
                         constexpr bool is_square() const {
-                            element_fp2 tmp = this->pow(policy_type::group_order);
-                            return (tmp.is_one() || tmp.is_zero());    // maybe can be done more effective
+                            if constexpr (underlying_type::is_fixed_montgomery) {
+                                // an element is a square if and only if its norm A0^2 - non_residue * A1^2 is
+                                const underlying_type &A0 = data[0], &A1 = data[1];
+                                return (A0.squared() - non_residue * A1.squared()).is_square();
+                            } else {
+                                element_fp2 tmp = this->pow(policy_type::group_order);
+                                return (tmp.is_one() || tmp.is_zero());    // maybe can be done more effective
+                            }
+                        }
+
+                        /// Inversion through the norm as in inversed(), for public values only
+                        constexpr element_fp2 inversed_vartime() const {
+                            const underlying_type &A0 = data[0], &A1 = data[1];
+
+                            const underlying_type t3 = (A0.squared() - non_residue * A1.squared()).inversed_vartime();
+
+                            return element_fp2(A0 * t3, -(A1 * t3));
                         }
 
                         template<typename PowerType>
@@ -291,6 +343,74 @@ namespace nil {
                         }
                     };
 
+                    /**
+                     * Pair of unreduced Fp products. Used to accumulate Fp2, Fp6 and Fp12 products
+                     * with a single Montgomery reduction per Fp coefficient.
+                     */
+                    template<typename FieldParams>
+                    class element_fp2_unreduced {
+                        typedef FieldParams policy_type;
+
+                        typedef typename policy_type::underlying_type underlying_type;
+                        typedef typename underlying_type::unreduced_type underlying_unreduced_type;
+
+                    public:
+                        typedef element_fp2<FieldParams> reduced_type;
+
+                        using data_type = std::array<underlying_unreduced_type, 2>;
+                        data_type data;
+
+                        constexpr element_fp2_unreduced() : data {} {};
+
+                        constexpr element_fp2_unreduced(const underlying_unreduced_type &in_data0,
+                                                        const underlying_unreduced_type &in_data1) :
+                            data({in_data0, in_data1}) {};
+
+                        constexpr element_fp2_unreduced operator+(const element_fp2_unreduced &B) const {
+                            return element_fp2_unreduced(data[0] + B.data[0], data[1] + B.data[1]);
+                        }
+
+                        constexpr element_fp2_unreduced operator-(const element_fp2_unreduced &B) const {
+                            return element_fp2_unreduced(data[0] - B.data[0], data[1] - B.data[1]);
+                        }
+
+                        constexpr element_fp2_unreduced &operator+=(const element_fp2_unreduced &B) {
+                            data[0] += B.data[0];
+                            data[1] += B.data[1];
+
+                            return *this;
+                        }
+
+                        constexpr element_fp2_unreduced &operator-=(const element_fp2_unreduced &B) {
+                            data[0] -= B.data[0];
+                            data[1] -= B.data[1];
+
+                            return *this;
+                        }
+
+                        constexpr element_fp2_unreduced doubled() const {
+                            return element_fp2_unreduced(data[0].doubled(), data[1].doubled());
+                        }
+
+                        /// Multiplication by x + y * u, e.g. by the non-residue of the next extension
+                        constexpr element_fp2_unreduced mul_by_small(int x, int y) const {
+                            const underlying_unreduced_type A1 =
+                                mul_by_integral(data[1], policy_type::small_non_residue);
+
+                            return element_fp2_unreduced(mul_by_integral(data[0], x) + mul_by_integral(A1, y),
+                                                         mul_by_integral(data[0], y) + mul_by_integral(data[1], x));
+                        }
+
+                        constexpr reduced_type reduced() const {
+                            return reduced_type(data[0].reduced(), data[1].reduced());
+                        }
+
+                        constexpr static underlying_unreduced_type mul_by_integral(const underlying_unreduced_type &A,
+                                                                                   int k) {
+                            return k < 0 ? -A.scaled(std::size_t(-k)) : A.scaled(std::size_t(k));
+                        }
+                    };
+
                     template<typename FieldParams>
                     constexpr element_fp2<FieldParams> operator*(const typename FieldParams::underlying_type &lhs,
                                                                  const element_fp2<FieldParams> &rhs) {
@@ -78,7 +78,7 @@ namespace nil {
                             data = data_type({in_data0, in_data1, in_data2});
                         }
 
-                        constexpr element_fp3(const element_fp3 &B) : data {B.data} {};
+                        constexpr element_fp3(const element_fp3 &B) = default;
 
                         constexpr inline static element_fp3 zero() {
                             return element_fp3(
@@ -108,12 +108,13 @@ namespace nil {
                             return (data[0] != B.data[0]) || (data[1] != B.data[1]) || (data[2] != B.data[2]);
                         }
 
-                        constexpr element_fp3 &operator=(const element_fp3 &B) {
-                            data[0] = B.data[0];
-                            data[1] = B.data[1];
-                            data[2] = B.data[2];
+                        constexpr element_fp3 &operator=(const element_fp3 &B) = default;
 
-                            return *this;
+                        /// *this = flag ? B : *this, coefficient by coefficient without branching on flag
+                        constexpr void conditional_assign(const element_fp3 &B, bool flag) {
+                            for (std::size_t i = 0; i < data.size(); ++i) {
+                                data[i].conditional_assign(B.data[i], flag);
+                            }
                         }
 
                         constexpr element_fp3 operator+(const element_fp3 &B) const {
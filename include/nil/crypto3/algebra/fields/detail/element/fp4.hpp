@@ -89,6 +89,13 @@ namespace nil {
                             return *this;
                         }
 
+                        /// *this = flag ? B : *this, coefficient by coefficient without branching on flag
+                        constexpr void conditional_assign(const element_fp4 &B, bool flag) {
+                            for (std::size_t i = 0; i < data.size(); ++i) {
+                                data[i].conditional_assign(B.data[i], flag);
+                            }
+                        }
+
                         constexpr element_fp4 operator+(const element_fp4 &B) const {
                             return element_fp4(data[0] + B.data[0], data[1] + B.data[1]);
                         }
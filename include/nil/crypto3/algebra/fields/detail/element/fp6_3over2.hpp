@@ -35,6 +35,9 @@ namespace nil {
             namespace fields {
                 namespace detail {
 
+                    template<typename FieldParams>
+                    class element_fp6_3over2_unreduced;
+
                     template<typename FieldParams>
                     class element_fp6_3over2 {
                         typedef FieldParams policy_type;
@@ -50,6 +53,12 @@ namespace nil {
 
                         data_type data;
 
+                        /// Products are reduced once per Fp coefficient, see element_fp6_3over2_unreduced
+                        constexpr static const bool lazy_reduction =
+                            underlying_type::lazy_reduction && has_small_non_residue<policy_type>::value;
+
+                        typedef element_fp6_3over2_unreduced<FieldParams> unreduced_type;
+
                         constexpr element_fp6_3over2() {
                             data =
                                 data_type({underlying_type::zero(), underlying_type::zero(), underlying_type::zero()});
@@ -93,6 +102,13 @@ namespace nil {
                             return *this;
                         }
 
+                        /// *this = flag ? B : *this, coefficient by coefficient without branching on flag
+                        constexpr void conditional_assign(const element_fp6_3over2 &B, bool flag) {
+                            for (std::size_t i = 0; i < data.size(); ++i) {
+                                data[i].conditional_assign(B.data[i], flag);
+                            }
+                        }
+
                         constexpr element_fp6_3over2 operator+(const element_fp6_3over2 &B) const {
                             return element_fp6_3over2(data[0] + B.data[0], data[1] + B.data[1], data[2] + B.data[2]);
                         }
@@ -126,6 +142,10 @@ namespace nil {
                         }
 
                         constexpr element_fp6_3over2 operator*(const element_fp6_3over2 &B) const {
+                            if constexpr (lazy_reduction) {
+                                return mul_unreduced(B).reduced();
+                            }
+
                             const underlying_type A0B0 = data[0] * B.data[0], A1B1 = data[1] * B.data[1],
                                                   A2B2 = data[2] * B.data[2];
 
@@ -135,6 +155,20 @@ namespace nil {
                                 (data[0] + data[2]) * (B.data[0] + B.data[2]) - A0B0 + A1B1 - A2B2);
                         }
 
+                        /// Karatsuba product with all six Fp coefficients left unreduced
+                        constexpr unreduced_type mul_unreduced(const element_fp6_3over2 &B) const {
+                            const underlying_type &A0 = data[0], &A1 = data[1], &A2 = data[2], &B0 = B.data[0],
+                                                  &B1 = B.data[1], &B2 = B.data[2];
+                            const typename underlying_type::unreduced_type A0B0 = A0.mul_unreduced(B0),
+                                                                           A1B1 = A1.mul_unreduced(B1),
+                                                                           A2B2 = A2.mul_unreduced(B2);
+
+                            return unreduced_type(
+                                A0B0 + unreduced_type::mul_by_xi((A1 + A2).mul_unreduced(B1 + B2) - A1B1 - A2B2),
+                                (A0 + A1).mul_unreduced(B0 + B1) - A0B0 - A1B1 + unreduced_type::mul_by_xi(A2B2),
+                                (A0 + A2).mul_unreduced(B0 + B2) - A0B0 + A1B1 - A2B2);
+                        }
+
                         element_fp6_3over2 sqrt() const {
 
                             // compute squared root with Tonelli--Shanks
@@ -152,6 +186,44 @@ namespace nil {
                             return element_fp6_3over2(data[0], data[1].mul_Fp_0(B[1]), data[2].mul_Fp_0(B[0]));
                         }
 
+                        /// Multiplication by B1 * v
+                        constexpr element_fp6_3over2 mul_by_1(const underlying_type &B1) const {
+                            const underlying_type A0 = data[0], A1 = data[1], A2 = data[2];
+
+                            return element_fp6_3over2(mul_by_non_residue(A2 * B1), A0 * B1, A1 * B1);
+                        }
+
+                        /// Multiplication by B0 + B1 * v
+                        constexpr element_fp6_3over2 mul_by_01(const underlying_type &B0,
+                                                               const underlying_type &B1) const {
+                            const underlying_type A0 = data[0], A1 = data[1], A2 = data[2];
+                            const underlying_type A0B0 = A0 * B0, A1B1 = A1 * B1;
+
+                            return element_fp6_3over2(A0B0 + mul_by_non_residue(A2 * B1),
+                                                      (A0 + A1) * (B0 + B1) - A0B0 - A1B1, A2 * B0 + A1B1);
+                        }
+
+                        /// Multiplication by B0 + B2 * v^2
+                        constexpr element_fp6_3over2 mul_by_02(const underlying_type &B0,
+                                                               const underlying_type &B2) const {
+                            const underlying_type A0 = data[0], A1 = data[1], A2 = data[2];
+                            const underlying_type A0B0 = A0 * B0, A2B2 = A2 * B2;
+
+                            return element_fp6_3over2(A0B0 + mul_by_non_residue(A1 * B2),
+                                                      A1 * B0 + mul_by_non_residue(A2B2),
+                                                      (A0 + A2) * (B0 + B2) - A0B0 - A2B2);
+                        }
+
+                        /// Multiplication by B1 * v + B2 * v^2
+                        constexpr element_fp6_3over2 mul_by_12(const underlying_type &B1,
+                                                               const underlying_type &B2) const {
+                            const underlying_type A0 = data[0], A1 = data[1], A2 = data[2];
+                            const underlying_type A1B1 = A1 * B1, A2B2 = A2 * B2;
+
+                            return element_fp6_3over2(mul_by_non_residue((A1 + A2) * (B1 + B2) - A1B1 - A2B2),
+                                                      A0 * B1 + mul_by_non_residue(A2B2), A0 * B2 + A1B1);
+                        }
+
                         constexpr element_fp6_3over2 squared() const {
                             return (*this) * (*this);    // maybe can be done more effective
                         }
@@ -205,6 +277,61 @@ namespace nil {
                         }
                     };
 
+                    /**
+                     * Fp6 element with unreduced Fp2 coefficients, see element_fp2_unreduced.
+                     */
+                    template<typename FieldParams>
+                    class element_fp6_3over2_unreduced {
+                        typedef FieldParams policy_type;
+
+                        typedef typename policy_type::underlying_type underlying_type;
+                        typedef typename underlying_type::unreduced_type underlying_unreduced_type;
+
+                    public:
+                        typedef element_fp6_3over2<FieldParams> reduced_type;
+
+                        using data_type = std::array<underlying_unreduced_type, 3>;
+                        data_type data;
+
+                        constexpr element_fp6_3over2_unreduced() : data {} {};
+
+                        constexpr element_fp6_3over2_unreduced(const underlying_unreduced_type &in_data0,
+                                                               const underlying_unreduced_type &in_data1,
+                                                               const underlying_unreduced_type &in_data2) :
+                            data({in_data0, in_data1, in_data2}) {};
+
+                        constexpr element_fp6_3over2_unreduced
+                            operator+(const element_fp6_3over2_unreduced &B) const {
+                            return element_fp6_3over2_unreduced(data[0] + B.data[0], data[1] + B.data[1],
+                                                                data[2] + B.data[2]);
+                        }
+
+                        constexpr element_fp6_3over2_unreduced
+                            operator-(const element_fp6_3over2_unreduced &B) const {
+                            return element_fp6_3over2_unreduced(data[0] - B.data[0], data[1] - B.data[1],
+                                                                data[2] - B.data[2]);
+                        }
+
+                        constexpr element_fp6_3over2_unreduced doubled() const {
+                            return element_fp6_3over2_unreduced(data[0].doubled(), data[1].doubled(),
+                                                                data[2].doubled());
+                        }
+
+                        /// Multiplication by v, where v^3 is the non-residue
+                        constexpr element_fp6_3over2_unreduced mul_by_non_residue() const {
+                            return element_fp6_3over2_unreduced(mul_by_xi(data[2]), data[0], data[1]);
+                        }
+
+                        constexpr reduced_type reduced() const {
+                            return reduced_type(data[0].reduced(), data[1].reduced(), data[2].reduced());
+                        }
+
+                        constexpr static underlying_unreduced_type mul_by_xi(const underlying_unreduced_type &A) {
+                            return A.mul_by_small(policy_type::small_non_residue[0],
+                                                  policy_type::small_non_residue[1]);
+                        }
+                    };
+
                     template<typename FieldParams>
                     constexpr element_fp6_3over2<FieldParams>
                         operator*(const typename FieldParams::underlying_type::underlying_type &lhs,
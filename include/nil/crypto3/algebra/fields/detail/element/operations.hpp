@@ -28,11 +28,25 @@
 
 #include <nil/crypto3/algebra/type_traits.hpp>
 
+#include <type_traits>
+
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace fields {
                 namespace detail {
+                    /**
+                     * Extension params opt in to lazy-reduction multiplication by providing small_non_residue,
+                     * the non-residue as small integer coefficients over the underlying field.
+                     */
+                    template<typename ExtensionParams, typename = void>
+                    struct has_small_non_residue : std::false_type { };
+
+                    template<typename ExtensionParams>
+                    struct has_small_non_residue<ExtensionParams,
+                                                 std::void_t<decltype(ExtensionParams::small_non_residue)>>
+                        : std::true_type { };
+
                     template<typename FieldElement, typename Integral,
                              typename = typename std::enable_if<is_field_element<FieldElement>::value &&
                                                      std::is_constructible<FieldElement, Integral>::value>::type>
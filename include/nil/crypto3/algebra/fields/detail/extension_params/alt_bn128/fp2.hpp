@@ -86,12 +86,17 @@ namespace nil {
 
                         constexpr static const non_residue_type non_residue = non_residue_type(
                             0x30644E72E131A029B85045B68181585D97816A916871CA8D3C208C16D87CFD46_cppui254);
+                        /// non_residue as a small integer, for lazy-reduction multiplication
+                        constexpr static const int small_non_residue = -1;
                     };
 
                     template<std::size_t Version>
                     constexpr typename fp2_extension_params<alt_bn128_base_field<Version>>::non_residue_type const
                         fp2_extension_params<alt_bn128_base_field<Version>>::non_residue;
 
+                    template<std::size_t Version>
+                    constexpr int const fp2_extension_params<alt_bn128_base_field<Version>>::small_non_residue;
+
                     template<std::size_t Version>
                     constexpr typename std::size_t const fp2_extension_params<alt_bn128_base_field<Version>>::s;
 
@@ -118,6 +118,8 @@ namespace nil {
                             0x10DE546FF8D4AB51D2B513CDBB25772454326430418536D15721E37E70C255C9_cppui253};
 
                         constexpr static const non_residue_type non_residue = non_residue_type(0x09, 0x01);
+                        /// non_residue as small integer coefficients, for lazy-reduction multiplication
+                        constexpr static const std::array<int, 2> small_non_residue = {0x09, 0x01};
                     };
 
                     template<std::size_t Version>
@@ -125,6 +127,10 @@ namespace nil {
                         typename fp6_3over2_extension_params<alt_bn128_base_field<Version>>::non_residue_type const
                             fp6_3over2_extension_params<alt_bn128_base_field<Version>>::non_residue;
 
+                    template<std::size_t Version>
+                    constexpr std::array<int, 2> const
+                        fp6_3over2_extension_params<alt_bn128_base_field<Version>>::small_non_residue;
+
                     template<std::size_t Version>
                     constexpr std::array<
                         typename fp6_3over2_extension_params<alt_bn128_base_field<Version>>::integral_type, 6 * 2> const
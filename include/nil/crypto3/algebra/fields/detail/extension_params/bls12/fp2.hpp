@@ -88,6 +88,8 @@ namespace nil {
 
                         constexpr static const non_residue_type non_residue = non_residue_type(
                             0x1A0111EA397FE69A4B1BA7B6434BACD764774B84F38512BF6730D2A0F6B0F6241EABFFFEB153FFFFB9FEFFFFFFFFAAAA_cppui381);
+                        /// non_residue as a small integer, for lazy-reduction multiplication
+                        constexpr static const int small_non_residue = -1;
                     };
 
                     /************************* BLS12-377 ***********************************/
@@ -141,6 +143,8 @@ namespace nil {
                     constexpr typename fp2_extension_params<bls12_base_field<377>>::non_residue_type const
                         fp2_extension_params<bls12_base_field<377>>::non_residue;
 
+                    constexpr int const fp2_extension_params<bls12_base_field<381>>::small_non_residue;
+
                     constexpr typename std::size_t const fp2_extension_params<bls12_base_field<381>>::s;
                     constexpr typename std::size_t const fp2_extension_params<bls12_base_field<377>>::s;
 
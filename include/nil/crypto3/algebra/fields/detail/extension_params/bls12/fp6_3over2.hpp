@@ -116,6 +116,8 @@ namespace nil {
                             0x00};
 
                         constexpr static const non_residue_type non_residue = non_residue_type(0x01, 0x01);
+                        /// non_residue as small integer coefficients, for lazy-reduction multiplication
+                        constexpr static const std::array<int, 2> small_non_residue = {0x01, 0x01};
                     };
 
                     /************************* BLS12-377 ***********************************/
@@ -197,6 +199,9 @@ namespace nil {
                     constexpr typename fp6_3over2_extension_params<bls12_base_field<377>>::non_residue_type const
                         fp6_3over2_extension_params<bls12_base_field<377>>::non_residue;
 
+                    constexpr std::array<int, 2> const
+                        fp6_3over2_extension_params<bls12_base_field<381>>::small_non_residue;
+
                     constexpr std::array<typename fp6_3over2_extension_params<bls12_base_field<381>>::integral_type,
                                          6 * 2> const
                         fp6_3over2_extension_params<bls12_base_field<381>>::Frobenius_coeffs_c1;
@@ -0,0 +1,456 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_MONTGOMERY_ARITHMETIC_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_MONTGOMERY_ARITHMETIC_HPP
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+#if defined(__SIZEOF_INT128__)
+                    /**
+                     * @brief Montgomery multiplication with the modulus fixed at compile time.
+                     *
+                     * Operates on 64-bit limb arrays of the size of the modulus, in the Montgomery form
+                     * with R = 2^(64 * limbs_count), which is the form modular_adaptor keeps its values in
+                     * for odd moduli. The limbs are those of multiprecision, so that the backend of a modular
+                     * number may be operated on in place. The modulus comes from the field as montgomery_modulus_limbs,
+                     * least significant limb first.
+                     *
+                     * Multiplication is the CIOS method from
+                     * Koc, Acar, Kaliski, "Analyzing and Comparing Montgomery Multiplication Algorithms",
+                     * IEEE Micro 16(3), 1996. For moduli whose top limb leaves a spare bit the carry limbs
+                     * of CIOS can never be set and the shorter "no-carry" variant is used, see
+                     * https://hackmd.io/@gnark/modular_multiplication.
+                     * All the loops have compile-time bounds, so they are fully unrolled by the compiler.
+                     */
+                    template<typename FieldType>
+                    struct fixed_montgomery_arithmetic {
+                        typedef multiprecision::limb_type limb_type;
+                        typedef unsigned __int128 double_limb_type;
+
+                        static_assert(sizeof(limb_type) == sizeof(std::uint64_t), "64-bit limbs are required");
+
+                        constexpr static const std::size_t limbs_count =
+                            std::tuple_size<typename std::remove_cv<
+                                decltype(FieldType::montgomery_modulus_limbs)>::type>::value;
+                        constexpr static const std::size_t limb_bits = 64;
+
+                        typedef std::array<limb_type, limbs_count> limbs_type;
+
+                    private:
+                        constexpr static limbs_type load_modulus() {
+                            limbs_type result = {};
+                            for (std::size_t i = 0; i < limbs_count; ++i) {
+                                result[i] = FieldType::montgomery_modulus_limbs[i];
+                            }
+                            return result;
+                        }
+
+                    public:
+                        constexpr static const limbs_type modulus = load_modulus();
+
+                    private:
+                        constexpr static limb_type compute_p_dash() {
+                            // Newton's iteration for p^{-1} mod 2^64, every step doubles the number of correct bits
+                            limb_type inverse = 1;
+                            for (std::size_t i = 0; i < 6; ++i) {
+                                inverse *= 2 - modulus[0] * inverse;
+                            }
+                            return ~inverse + 1;
+                        }
+
+                    public:
+                        /// -p^{-1} mod 2^64
+                        constexpr static const limb_type p_dash = compute_p_dash();
+
+                        /// The top limb of the modulus is below 2^63 - 1
+                        constexpr static const bool no_carry =
+                            modulus[limbs_count - 1] < (~limb_type(0) >> 1);
+
+                        /// 2p < R, so sums of two values below p * R do not overflow 2 * limbs_count limbs
+                        constexpr static const bool has_spare_bit = (modulus[limbs_count - 1] >> (limb_bits - 1)) == 0;
+
+                        typedef std::array<limb_type, 2 * limbs_count> wide_limbs_type;
+
+                        static_assert(modulus[0] & 1, "Montgomery multiplication requires an odd modulus");
+
+                        /// result = a * b * R^{-1} mod p, for a, b < p
+                        constexpr static inline void mul(limbs_type &result, const limbs_type &a, const limbs_type &b) {
+                            mul(result.data(), a.data(), b.data());
+                        }
+
+                        /// Same as above on limbs_count limbs, result may alias a or b
+                        constexpr static inline void mul(limb_type *result, const limb_type *a, const limb_type *b) {
+                            if (no_carry) {
+                                mul_no_carry(result, a, b);
+                            } else {
+                                mul_cios(result, a, b);
+                            }
+                        }
+
+                        constexpr static inline void mul_cios(limb_type *result, const limb_type *a,
+                                                              const limb_type *b) {
+                            std::array<limb_type, limbs_count + 2> t = {};
+
+                            for (std::size_t i = 0; i < limbs_count; ++i) {
+                                // t += a * b[i]
+                                limb_type carry = 0;
+                                for (std::size_t j = 0; j < limbs_count; ++j) {
+                                    const double_limb_type s =
+                                        double_limb_type(t[j]) + double_limb_type(a[j]) * b[i] + carry;
+                                    t[j] = limb_type(s);
+                                    carry = limb_type(s >> limb_bits);
+                                }
+                                double_limb_type s = double_limb_type(t[limbs_count]) + carry;
+                                t[limbs_count] = limb_type(s);
+                                t[limbs_count + 1] = limb_type(s >> limb_bits);
+
+                                // t = (t + m * p) / 2^64
+                                const limb_type m = t[0] * p_dash;
+                                s = double_limb_type(t[0]) + double_limb_type(m) * modulus[0];
+                                carry = limb_type(s >> limb_bits);
+                                for (std::size_t j = 1; j < limbs_count; ++j) {
+                                    s = double_limb_type(t[j]) + double_limb_type(m) * modulus[j] + carry;
+                                    t[j - 1] = limb_type(s);
+                                    carry = limb_type(s >> limb_bits);
+                                }
+                                s = double_limb_type(t[limbs_count]) + carry;
+                                t[limbs_count - 1] = limb_type(s);
+                                t[limbs_count] = t[limbs_count + 1] + limb_type(s >> limb_bits);
+                            }
+
+                            for (std::size_t i = 0; i < limbs_count; ++i) {
+                                result[i] = t[i];
+                            }
+                            if (t[limbs_count] != 0 || !less_than_modulus(result)) {
+                                subtract_modulus(result);
+                            }
+                        }
+
+                        constexpr static inline void mul_no_carry(limb_type *result, const limb_type *a,
+                                                                  const limb_type *b) {
+                            limbs_type t = {};
+
+                            for (std::size_t i = 0; i < limbs_count; ++i) {
+                                double_limb_type s = double_limb_type(a[0]) * b[i] + t[0];
+                                limb_type a_carry = limb_type(s >> limb_bits);
+                                const limb_type t0 = limb_type(s);
+
+                                const limb_type m = t0 * p_dash;
+                                s = double_limb_type(m) * modulus[0] + t0;
+                                limb_type m_carry = limb_type(s >> limb_bits);
+
+                                for (std::size_t j = 1; j < limbs_count; ++j) {
+                                    s = double_limb_type(a[j]) * b[i] + t[j] + a_carry;
+                                    a_carry = limb_type(s >> limb_bits);
+                                    s = double_limb_type(m) * modulus[j] + limb_type(s) + m_carry;
+                                    m_carry = limb_type(s >> limb_bits);
+                                    t[j - 1] = limb_type(s);
+                                }
+
+                                t[limbs_count - 1] = a_carry + m_carry;
+                            }
+
+                            for (std::size_t i = 0; i < limbs_count; ++i) {
+                                result[i] = t[i];
+                            }
+                            if (!less_than_modulus(result)) {
+                                subtract_modulus(result);
+                            }
+                        }
+
+                        /// result = a * b, without reduction
+                        constexpr static inline void mul_wide(wide_limbs_type &result, const limbs_type &a,
+                                                              const limbs_type &b) {
+                            mul_wide(result, a.data(), b.data());
+                        }
+
+                        constexpr static inline void mul_wide(wide_limbs_type &result, const limb_type *a,
+                                                              const limb_type *b) {
+                            result = {};
+
+                            for (std::size_t i = 0; i < limbs_count; ++i) {
+                                limb_type carry = 0;
+                                for (std::size_t j = 0; j < limbs_count; ++j) {
+                                    const double_limb_type s =
+                                        double_limb_type(result[i + j]) + double_limb_type(a[j]) * b[i] + carry;
+                                    result[i + j] = limb_type(s);
+                                    carry = limb_type(s >> limb_bits);
+                                }
+                                result[i + limbs_count] = carry;
+                            }
+                        }
+
+                        /// result = a + b mod p * R, for a, b < p * R. Requires has_spare_bit.
+                        constexpr static inline void add_wide(wide_limbs_type &result, const wide_limbs_type &a,
+                                                              const wide_limbs_type &b) {
+                            limb_type carry = 0;
+                            for (std::size_t i = 0; i < 2 * limbs_count; ++i) {
+                                const double_limb_type s = double_limb_type(a[i]) + b[i] + carry;
+                                result[i] = limb_type(s);
+                                carry = limb_type(s >> limb_bits);
+                            }
+
+                            if (!less_than_modulus(result.data() + limbs_count)) {
+                                subtract_modulus(result.data() + limbs_count);
+                            }
+                        }
+
+                        /// result = a - b mod p * R, for a, b < p * R
+                        constexpr static inline void sub_wide(wide_limbs_type &result, const wide_limbs_type &a,
+                                                              const wide_limbs_type &b) {
+                            limb_type borrow = 0;
+                            for (std::size_t i = 0; i < 2 * limbs_count; ++i) {
+                                const double_limb_type d = double_limb_type(a[i]) - b[i] - borrow;
+                                result[i] = limb_type(d);
+                                borrow = limb_type(d >> limb_bits) & 1;
+                            }
+
+                            if (borrow) {
+                                add_modulus(result.data() + limbs_count);
+                            }
+                        }
+
+                        /// Montgomery reduction: result = t * R^{-1} mod p, for t < p * R
+                        constexpr static inline void reduce(limbs_type &result, const wide_limbs_type &t) {
+                            reduce(result.data(), t);
+                        }
+
+                        constexpr static inline void reduce(limb_type *result, const wide_limbs_type &t) {
+                            std::array<limb_type, 2 * limbs_count + 1> u = {};
+                            for (std::size_t i = 0; i < 2 * limbs_count; ++i) {
+                                u[i] = t[i];
+                            }
+
+                            for (std::size_t i = 0; i < limbs_count; ++i) {
+                                const limb_type m = u[i] * p_dash;
+
+                                limb_type carry = 0;
+                                for (std::size_t j = 0; j < limbs_count; ++j) {
+                                    const double_limb_type s =
+                                        double_limb_type(u[i + j]) + double_limb_type(m) * modulus[j] + carry;
+                                    u[i + j] = limb_type(s);
+                                    carry = limb_type(s >> limb_bits);
+                                }
+                                for (std::size_t j = i + limbs_count; j < 2 * limbs_count + 1; ++j) {
+                                    const double_limb_type s = double_limb_type(u[j]) + carry;
+                                    u[j] = limb_type(s);
+                                    carry = limb_type(s >> limb_bits);
+                                }
+                            }
+
+                            for (std::size_t i = 0; i < limbs_count; ++i) {
+                                result[i] = u[i + limbs_count];
+                            }
+                            if (u[2 * limbs_count] != 0 || !less_than_modulus(result)) {
+                                subtract_modulus(result);
+                            }
+                        }
+
+                        constexpr static inline bool less_than_modulus(const limbs_type &a) {
+                            return less_than_modulus(a.data());
+                        }
+
+                        constexpr static inline void subtract_modulus(limbs_type &a) {
+                            subtract_modulus(a.data());
+                        }
+
+                        constexpr static inline bool less_than_modulus(const limb_type *a) {
+                            for (std::size_t i = limbs_count - 1; i < limbs_count; --i) {
+                                if (a[i] != modulus[i]) {
+                                    return a[i] < modulus[i];
+                                }
+                            }
+                            return false;
+                        }
+
+                        constexpr static inline void subtract_modulus(limb_type *a) {
+                            limb_type borrow = 0;
+                            for (std::size_t i = 0; i < limbs_count; ++i) {
+                                const double_limb_type d = double_limb_type(a[i]) - modulus[i] - borrow;
+                                a[i] = limb_type(d);
+                                borrow = limb_type(d >> limb_bits) & 1;
+                            }
+                        }
+
+                        constexpr static inline void add_modulus(limb_type *a) {
+                            limb_type carry = 0;
+                            for (std::size_t i = 0; i < limbs_count; ++i) {
+                                const double_limb_type s = double_limb_type(a[i]) + modulus[i] + carry;
+                                a[i] = limb_type(s);
+                                carry = limb_type(s >> limb_bits);
+                            }
+                        }
+                    };
+
+                    template<typename FieldType>
+                    constexpr typename fixed_montgomery_arithmetic<FieldType>::limbs_type const
+                        fixed_montgomery_arithmetic<FieldType>::modulus;
+
+                    template<typename FieldType>
+                    constexpr typename fixed_montgomery_arithmetic<FieldType>::limb_type const
+                        fixed_montgomery_arithmetic<FieldType>::p_dash;
+#else
+                    /// Not available without a 128-bit integer type, no field satisfies is_fixed_montgomery_field
+                    template<typename FieldType>
+                    struct fixed_montgomery_arithmetic;
+#endif
+
+                    /**
+                     * A field opts in to fixed_montgomery_arithmetic by providing montgomery_modulus_limbs.
+                     * Requires 64-bit multiprecision limbs and a 128-bit integer type.
+                     */
+                    template<typename FieldType, typename = void>
+                    struct is_fixed_montgomery_field : std::false_type { };
+
+#if defined(__SIZEOF_INT128__) && !defined(CRYPTO3_ALGEBRA_DISABLE_FIXED_MONTGOMERY)
+                    template<typename FieldType>
+                    struct is_fixed_montgomery_field<FieldType,
+                                                     std::void_t<decltype(FieldType::montgomery_modulus_limbs)>>
+                        : std::integral_constant<bool, sizeof(multiprecision::limb_type) == sizeof(std::uint64_t)> {
+                    };
+#endif
+
+                    /**
+                     * Products of a field satisfying is_fixed_montgomery_field may be accumulated
+                     * unreduced modulo p * R if the top bit of the modulus is clear.
+                     */
+                    template<typename FieldType, bool = is_fixed_montgomery_field<FieldType>::value>
+                    struct is_lazy_reduction_field : std::false_type { };
+
+                    template<typename FieldType>
+                    struct is_lazy_reduction_field<FieldType, true>
+                        : std::integral_constant<bool, fixed_montgomery_arithmetic<FieldType>::has_spare_bit> { };
+
+                    /**
+                     * Copies the Montgomery form of a modular number of a field satisfying
+                     * is_fixed_montgomery_field to a limb array, and back.
+                     */
+                    template<typename FieldType, typename ModularNumber>
+                    constexpr inline void load_montgomery_limbs(
+                        typename fixed_montgomery_arithmetic<FieldType>::limbs_type &limbs, const ModularNumber &a) {
+                        const auto &base = a.backend().base_data();
+
+                        limbs = {};
+                        for (std::size_t i = 0; i < base.size(); ++i) {
+                            limbs[i] = base.limbs()[i];
+                        }
+                    }
+
+                    template<typename FieldType, typename ModularNumber>
+                    constexpr inline void store_montgomery_limbs(
+                        ModularNumber &a, const typename fixed_montgomery_arithmetic<FieldType>::limbs_type &limbs) {
+                        constexpr const std::size_t limbs_count = fixed_montgomery_arithmetic<FieldType>::limbs_count;
+                        auto &base = a.backend().base_data();
+
+                        base.resize(limbs_count, limbs_count);
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            base.limbs()[i] = limbs[i];
+                        }
+                        base.normalize();
+                    }
+
+                    /**
+                     * Read-only view of the Montgomery form of a modular number as limbs_count limbs.
+                     * Points into the backend unless normalization dropped leading zero limbs,
+                     * in which case a zero-padded copy is taken.
+                     */
+                    template<typename FieldType>
+                    class montgomery_limbs_ref {
+                        typedef fixed_montgomery_arithmetic<FieldType> arithmetic_type;
+
+                    public:
+                        typedef typename arithmetic_type::limb_type limb_type;
+
+                        template<typename ModularNumber>
+                        constexpr explicit montgomery_limbs_ref(const ModularNumber &a) : padded {}, limbs(nullptr) {
+                            const auto &base = a.backend().base_data();
+
+                            if (base.size() == arithmetic_type::limbs_count) {
+                                limbs = base.limbs();
+                            } else {
+                                for (std::size_t i = 0; i < base.size(); ++i) {
+                                    padded[i] = base.limbs()[i];
+                                }
+                                limbs = padded.data();
+                            }
+                        }
+
+                        montgomery_limbs_ref(const montgomery_limbs_ref &) = delete;
+                        montgomery_limbs_ref &operator=(const montgomery_limbs_ref &) = delete;
+
+                        constexpr const limb_type *data() const {
+                            return limbs;
+                        }
+
+                    private:
+                        typename arithmetic_type::limbs_type padded;
+                        const limb_type *limbs;
+                    };
+
+                    /**
+                     * Lets write fill the limbs_count Montgomery limbs of a modular number in the backend,
+                     * then normalizes it.
+                     */
+                    template<typename FieldType, typename ModularNumber, typename Writer>
+                    constexpr inline void write_montgomery_limbs(ModularNumber &a, Writer &&write) {
+                        auto &base = a.backend().base_data();
+
+                        base.resize(fixed_montgomery_arithmetic<FieldType>::limbs_count,
+                                    fixed_montgomery_arithmetic<FieldType>::limbs_count);
+                        write(base.limbs());
+                        base.normalize();
+                    }
+
+                    /**
+                     * Multiplies two modular numbers of a field satisfying is_fixed_montgomery_field
+                     * in place of the generic modular_adaptor multiplication. result may be a or b.
+                     */
+                    template<typename FieldType, typename ModularNumber>
+                    constexpr inline void fixed_montgomery_mul(ModularNumber &result, const ModularNumber &a,
+                                                               const ModularNumber &b) {
+                        const montgomery_limbs_ref<FieldType> a_limbs(a), b_limbs(b);
+
+                        write_montgomery_limbs<FieldType>(
+                            result, [&](typename fixed_montgomery_arithmetic<FieldType>::limb_type *result_limbs) {
+                                fixed_montgomery_arithmetic<FieldType>::mul(result_limbs, a_limbs.data(),
+                                                                            b_limbs.data());
+                            });
+                    }
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_MONTGOMERY_ARITHMETIC_HPP
@@ -0,0 +1,472 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_SAFEGCD_INVERSION_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_SAFEGCD_INVERSION_HPP
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include <nil/crypto3/algebra/fields/detail/montgomery_arithmetic.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+#if defined(__SIZEOF_INT128__)
+                    /**
+                     * @brief Modular inversion with the modulus fixed at compile time.
+                     *
+                     * Inversion is the "safegcd" algorithm from
+                     * Bernstein, Yang, "Fast constant-time gcd computation and modular inversion",
+                     * TCHES 2019(3), https://eprint.iacr.org/2019/266. The divsteps are applied in batches of 62
+                     * to the bottom limbs only, and the resulting transition matrices are applied to the full
+                     * numbers kept in signed 62-bit limbs, following the layout of libsecp256k1 modinv64.
+                     *
+                     * inverse() always runs the number of divsteps sufficient for any input of the size of the
+                     * modulus (Theorem 11.2 of the paper) without branches on the input, for secret values.
+                     * inverse_vartime() skips runs of even values at once and stops as soon as the gcd is found,
+                     * for public values.
+                     *
+                     * Values are in the Montgomery form of fixed_montgomery_arithmetic.
+                     */
+                    template<typename FieldType>
+                    struct safegcd_inversion {
+                        typedef fixed_montgomery_arithmetic<FieldType> arithmetic_type;
+
+                        typedef typename arithmetic_type::limb_type limb_type;
+                        typedef typename arithmetic_type::limbs_type limbs_type;
+
+                        constexpr static const std::size_t limbs_count = arithmetic_type::limbs_count;
+
+                        constexpr static const std::size_t signed_limb_bits = 62;
+                        constexpr static const std::size_t signed_limbs_count =
+                            (arithmetic_type::limb_bits * limbs_count + signed_limb_bits - 1) / signed_limb_bits;
+
+                        typedef std::array<std::int64_t, signed_limbs_count> signed_limbs_type;
+
+                        /// Divsteps sufficient for any input below 2^d, d = 64 * limbs_count >= 46
+                        constexpr static const std::size_t divsteps_count =
+                            (49 * arithmetic_type::limb_bits * limbs_count + 80) / 17;
+                        constexpr static const std::size_t batches_count =
+                            (divsteps_count + signed_limb_bits - 1) / signed_limb_bits;
+
+                        static_assert(arithmetic_type::limb_bits * limbs_count >= 46,
+                                      "the divsteps bound of Theorem 11.2 holds for d >= 46");
+                        static_assert(batches_count * signed_limb_bits >= divsteps_count,
+                                      "the batches must cover the divsteps bound");
+
+                    private:
+                        typedef __int128 signed_double_limb_type;
+
+                        constexpr static const std::int64_t signed_limb_mask = std::int64_t(~limb_type(0) >> 2);
+
+                        /// Transition matrix of a batch of divsteps, scaled by 2^62
+                        struct transition_matrix {
+                            std::int64_t u, v, q, r;
+                        };
+
+                        constexpr static signed_limbs_type to_signed(const limbs_type &a) {
+                            signed_limbs_type result = {};
+                            for (std::size_t i = 0; i < signed_limbs_count; ++i) {
+                                const std::size_t limb = (signed_limb_bits * i) / arithmetic_type::limb_bits;
+                                const std::size_t shift = (signed_limb_bits * i) % arithmetic_type::limb_bits;
+
+                                limb_type w = a[limb] >> shift;
+                                if (shift > arithmetic_type::limb_bits - signed_limb_bits && limb + 1 < limbs_count) {
+                                    w |= a[limb + 1] << (arithmetic_type::limb_bits - shift);
+                                }
+                                result[i] = std::int64_t(w) & signed_limb_mask;
+                            }
+                            return result;
+                        }
+
+                        /// Requires the value in [0, p) with all the limbs in [0, 2^62)
+                        constexpr static limbs_type from_signed(const signed_limbs_type &a) {
+                            limbs_type result = {};
+                            for (std::size_t i = 0; i < signed_limbs_count; ++i) {
+                                const std::size_t limb = (signed_limb_bits * i) / arithmetic_type::limb_bits;
+                                const std::size_t shift = (signed_limb_bits * i) % arithmetic_type::limb_bits;
+
+                                result[limb] |= limb_type(a[i]) << shift;
+                                if (shift > arithmetic_type::limb_bits - signed_limb_bits && limb + 1 < limbs_count) {
+                                    result[limb + 1] |= limb_type(a[i]) >> (arithmetic_type::limb_bits - shift);
+                                }
+                            }
+                            return result;
+                        }
+
+                        constexpr static limbs_type compute_r3() {
+                            // R^2 by doubling one 2 * 64 * limbs_count times, then R^3 = R^2 * R^2 / R
+                            limbs_type r2 = {1};
+                            for (std::size_t i = 0; i < 2 * arithmetic_type::limb_bits * limbs_count; ++i) {
+                                limb_type carry = 0;
+                                for (std::size_t j = 0; j < limbs_count; ++j) {
+                                    const limb_type top = r2[j] >> (arithmetic_type::limb_bits - 1);
+                                    r2[j] = (r2[j] << 1) | carry;
+                                    carry = top;
+                                }
+                                if (carry || !arithmetic_type::less_than_modulus(r2)) {
+                                    arithmetic_type::subtract_modulus(r2);
+                                }
+                            }
+
+                            limbs_type r3 = {};
+                            arithmetic_type::mul(r3, r2, r2);
+                            return r3;
+                        }
+
+                        constexpr static std::int64_t compute_modulus_inverse() {
+                            // p_dash = -p^{-1} mod 2^64
+                            return std::int64_t(~arithmetic_type::p_dash + 1) & signed_limb_mask;
+                        }
+
+                    public:
+                        constexpr static const signed_limbs_type modulus = to_signed(arithmetic_type::modulus);
+
+                        /// p^{-1} mod 2^62
+                        constexpr static const std::int64_t modulus_inverse = compute_modulus_inverse();
+
+                        /// R^3 mod p, takes the inverse of a Montgomery form back to the Montgomery form
+                        constexpr static const limbs_type r3 = compute_r3();
+
+                        /// result = a^{-1}, or zero for a = 0, in constant time
+                        constexpr static inline void inverse(limbs_type &result, const limbs_type &a) {
+                            signed_limbs_type d = {}, e = {1}, f = modulus, g = to_signed(a);
+                            std::int64_t delta = 1;
+
+                            for (std::size_t i = 0; i < batches_count; ++i) {
+                                transition_matrix t = {};
+                                delta = divsteps(delta, f[0], g[0], t);
+                                update_de(d, e, t);
+                                update_fg(f, g, t);
+                            }
+
+                            normalize(d, f[signed_limbs_count - 1]);
+                            arithmetic_type::mul(result, from_signed(d), r3);
+                        }
+
+                        /// result = a^{-1}, or zero for a = 0, the running time depends on a
+                        constexpr static inline void inverse_vartime(limbs_type &result, const limbs_type &a) {
+                            signed_limbs_type d = {}, e = {1}, f = modulus, g = to_signed(a);
+                            std::int64_t delta = 1;
+
+                            while (!is_zero(g)) {
+                                transition_matrix t = {};
+                                delta = divsteps_vartime(delta, f[0], g[0], t);
+                                update_de(d, e, t);
+                                update_fg(f, g, t);
+                            }
+
+                            normalize(d, f[signed_limbs_count - 1]);
+                            arithmetic_type::mul(result, from_signed(d), r3);
+                        }
+
+                        /**
+                         * Legendre symbol of a: 1 for non-zero squares, -1 for non-squares and 0 for zero.
+                         * The Montgomery factor R = 2^(64 * limbs_count) is a square, so a may be given in
+                         * the Montgomery form. Binary Jacobi symbol algorithm, the running time depends on a.
+                         */
+                        constexpr static inline int legendre_symbol(const limbs_type &a) {
+                            limbs_type x = a, n = arithmetic_type::modulus;
+                            int result = 1;
+
+                            while (!is_zero(x)) {
+                                const std::size_t zeros = count_trailing_zeros(x);
+                                shift_right(x, zeros);
+                                // (2 / n) = -1 for n = 3, 5 mod 8
+                                if ((zeros & 1) && ((n[0] & 7) == 3 || (n[0] & 7) == 5)) {
+                                    result = -result;
+                                }
+
+                                // quadratic reciprocity, x and n are odd
+                                if (less_than(x, n)) {
+                                    std::swap(x, n);
+                                    if ((x[0] & 3) == 3 && (n[0] & 3) == 3) {
+                                        result = -result;
+                                    }
+                                }
+                                subtract(x, n);
+                            }
+
+                            return is_one(n) ? result : 0;
+                        }
+
+                    private:
+                        /// 62 divsteps on the bottom limbs of f and g without branches
+                        constexpr static inline std::int64_t divsteps(std::int64_t delta, limb_type f, limb_type g,
+                                                                      transition_matrix &t) {
+                            limb_type u = 1, v = 0, q = 0, r = 1;
+
+                            for (std::size_t i = 0; i < signed_limb_bits; ++i) {
+                                const limb_type odd = g & 1;
+                                const limb_type odd_mask = ~odd + 1;
+                                // all ones if delta > 0 and g is odd
+                                const limb_type swap_mask = ~((limb_type(-delta) >> 63) & odd) + 1;
+
+                                // (delta, f, g, u, v, q, r) = (-delta, g, -f, q, r, -u, -v) if swapping
+                                delta = std::int64_t((limb_type(delta) ^ swap_mask) - swap_mask);
+                                limb_type x = (f ^ g) & swap_mask;
+                                f ^= x;
+                                g ^= x;
+                                g = (g ^ swap_mask) - swap_mask;
+                                x = (u ^ q) & swap_mask;
+                                u ^= x;
+                                q ^= x;
+                                q = (q ^ swap_mask) - swap_mask;
+                                x = (v ^ r) & swap_mask;
+                                v ^= x;
+                                r ^= x;
+                                r = (r ^ swap_mask) - swap_mask;
+
+                                // g = (g + f) / 2 if g is odd, g / 2 otherwise
+                                g += f & odd_mask;
+                                q += u & odd_mask;
+                                r += v & odd_mask;
+                                g >>= 1;
+                                u <<= 1;
+                                v <<= 1;
+                                ++delta;
+                            }
+
+                            t = {std::int64_t(u), std::int64_t(v), std::int64_t(q), std::int64_t(r)};
+                            return delta;
+                        }
+
+                        /// 62 divsteps on the bottom limbs of f and g, runs of even g are skipped at once
+                        constexpr static inline std::int64_t divsteps_vartime(std::int64_t delta, limb_type f,
+                                                                              limb_type g, transition_matrix &t) {
+                            limb_type u = 1, v = 0, q = 0, r = 1;
+                            std::size_t i = signed_limb_bits;
+
+                            for (;;) {
+                                const std::size_t zeros = __builtin_ctzll(g | (~limb_type(0) << i));
+                                g >>= zeros;
+                                u <<= zeros;
+                                v <<= zeros;
+                                delta += zeros;
+                                i -= zeros;
+                                if (i == 0) {
+                                    break;
+                                }
+
+                                // g is odd, the halving is done by the next round
+                                if (delta > 0) {
+                                    delta = -delta;
+                                    std::swap(f, g);
+                                    g = ~g + 1;
+                                    std::swap(u, q);
+                                    q = ~q + 1;
+                                    std::swap(v, r);
+                                    r = ~r + 1;
+                                }
+                                g += f;
+                                q += u;
+                                r += v;
+                            }
+
+                            t = {std::int64_t(u), std::int64_t(v), std::int64_t(q), std::int64_t(r)};
+                            return delta;
+                        }
+
+                        /// [d, e] = t * [d, e] / 2^62 mod p, d and e stay in (-2p, p)
+                        constexpr static inline void update_de(signed_limbs_type &d, signed_limbs_type &e,
+                                                               const transition_matrix &t) {
+                            const std::int64_t sd = d[signed_limbs_count - 1] >> 63;
+                            const std::int64_t se = e[signed_limbs_count - 1] >> 63;
+
+                            // multiples of p making the bottom 62 bits zero, with [u, q] added for negative d
+                            // and [v, r] added for negative e to keep the results in range
+                            std::int64_t md = (t.u & sd) + (t.v & se);
+                            std::int64_t me = (t.q & sd) + (t.r & se);
+
+                            signed_double_limb_type cd = signed_double_limb_type(t.u) * d[0] +
+                                                         signed_double_limb_type(t.v) * e[0];
+                            signed_double_limb_type ce = signed_double_limb_type(t.q) * d[0] +
+                                                         signed_double_limb_type(t.r) * e[0];
+
+                            md -= std::int64_t(limb_type(modulus_inverse) * limb_type(cd) + limb_type(md)) &
+                                  signed_limb_mask;
+                            me -= std::int64_t(limb_type(modulus_inverse) * limb_type(ce) + limb_type(me)) &
+                                  signed_limb_mask;
+
+                            cd += signed_double_limb_type(modulus[0]) * md;
+                            ce += signed_double_limb_type(modulus[0]) * me;
+                            cd >>= signed_limb_bits;
+                            ce >>= signed_limb_bits;
+
+                            for (std::size_t i = 1; i < signed_limbs_count; ++i) {
+                                cd += signed_double_limb_type(t.u) * d[i] + signed_double_limb_type(t.v) * e[i] +
+                                      signed_double_limb_type(modulus[i]) * md;
+                                ce += signed_double_limb_type(t.q) * d[i] + signed_double_limb_type(t.r) * e[i] +
+                                      signed_double_limb_type(modulus[i]) * me;
+                                d[i - 1] = std::int64_t(cd) & signed_limb_mask;
+                                e[i - 1] = std::int64_t(ce) & signed_limb_mask;
+                                cd >>= signed_limb_bits;
+                                ce >>= signed_limb_bits;
+                            }
+
+                            d[signed_limbs_count - 1] = std::int64_t(cd);
+                            e[signed_limbs_count - 1] = std::int64_t(ce);
+                        }
+
+                        /// [f, g] = t * [f, g] / 2^62, the division is exact
+                        constexpr static inline void update_fg(signed_limbs_type &f, signed_limbs_type &g,
+                                                               const transition_matrix &t) {
+                            signed_double_limb_type cf = signed_double_limb_type(t.u) * f[0] +
+                                                         signed_double_limb_type(t.v) * g[0];
+                            signed_double_limb_type cg = signed_double_limb_type(t.q) * f[0] +
+                                                         signed_double_limb_type(t.r) * g[0];
+                            cf >>= signed_limb_bits;
+                            cg >>= signed_limb_bits;
+
+                            for (std::size_t i = 1; i < signed_limbs_count; ++i) {
+                                cf += signed_double_limb_type(t.u) * f[i] + signed_double_limb_type(t.v) * g[i];
+                                cg += signed_double_limb_type(t.q) * f[i] + signed_double_limb_type(t.r) * g[i];
+                                f[i - 1] = std::int64_t(cf) & signed_limb_mask;
+                                g[i - 1] = std::int64_t(cg) & signed_limb_mask;
+                                cf >>= signed_limb_bits;
+                                cg >>= signed_limb_bits;
+                            }
+
+                            f[signed_limbs_count - 1] = std::int64_t(cf);
+                            g[signed_limbs_count - 1] = std::int64_t(cg);
+                        }
+
+                        /// Brings r from (-2p, p) to [0, p), negating it first if sign is negative
+                        constexpr static inline void normalize(signed_limbs_type &r, std::int64_t sign) {
+                            std::int64_t cond_add = r[signed_limbs_count - 1] >> 63;
+                            const std::int64_t cond_negate = sign >> 63;
+                            for (std::size_t i = 0; i < signed_limbs_count; ++i) {
+                                r[i] += modulus[i] & cond_add;
+                                r[i] = (r[i] ^ cond_negate) - cond_negate;
+                            }
+                            propagate(r);
+
+                            cond_add = r[signed_limbs_count - 1] >> 63;
+                            for (std::size_t i = 0; i < signed_limbs_count; ++i) {
+                                r[i] += modulus[i] & cond_add;
+                            }
+                            propagate(r);
+                        }
+
+                        constexpr static inline void propagate(signed_limbs_type &r) {
+                            for (std::size_t i = 0; i + 1 < signed_limbs_count; ++i) {
+                                r[i + 1] += r[i] >> signed_limb_bits;
+                                r[i] &= signed_limb_mask;
+                            }
+                        }
+
+                        constexpr static inline bool is_zero(const signed_limbs_type &a) {
+                            for (std::size_t i = 0; i < signed_limbs_count; ++i) {
+                                if (a[i] != 0) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        }
+
+                        constexpr static inline bool is_zero(const limbs_type &a) {
+                            for (std::size_t i = 0; i < limbs_count; ++i) {
+                                if (a[i] != 0) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        }
+
+                        constexpr static inline bool is_one(const limbs_type &a) {
+                            for (std::size_t i = 1; i < limbs_count; ++i) {
+                                if (a[i] != 0) {
+                                    return false;
+                                }
+                            }
+                            return a[0] == 1;
+                        }
+
+                        constexpr static inline bool less_than(const limbs_type &a, const limbs_type &b) {
+                            for (std::size_t i = limbs_count - 1; i < limbs_count; --i) {
+                                if (a[i] != b[i]) {
+                                    return a[i] < b[i];
+                                }
+                            }
+                            return false;
+                        }
+
+                        /// a -= b, for a >= b
+                        constexpr static inline void subtract(limbs_type &a, const limbs_type &b) {
+                            limb_type borrow = 0;
+                            for (std::size_t i = 0; i < limbs_count; ++i) {
+                                const limb_type d = a[i] - b[i] - borrow;
+                                borrow = (a[i] < b[i]) || (a[i] == b[i] && borrow);
+                                a[i] = d;
+                            }
+                        }
+
+                        /// Requires non-zero a
+                        constexpr static inline std::size_t count_trailing_zeros(const limbs_type &a) {
+                            std::size_t i = 0;
+                            while (a[i] == 0) {
+                                ++i;
+                            }
+                            return arithmetic_type::limb_bits * i + __builtin_ctzll(a[i]);
+                        }
+
+                        constexpr static inline void shift_right(limbs_type &a, std::size_t bits) {
+                            const std::size_t limbs = bits / arithmetic_type::limb_bits;
+                            const std::size_t shift = bits % arithmetic_type::limb_bits;
+
+                            for (std::size_t i = 0; i < limbs_count; ++i) {
+                                limb_type w = i + limbs < limbs_count ? a[i + limbs] >> shift : 0;
+                                if (shift != 0 && i + limbs + 1 < limbs_count) {
+                                    w |= a[i + limbs + 1] << (arithmetic_type::limb_bits - shift);
+                                }
+                                a[i] = w;
+                            }
+                        }
+                    };
+
+                    template<typename FieldType>
+                    constexpr typename safegcd_inversion<FieldType>::signed_limbs_type const
+                        safegcd_inversion<FieldType>::modulus;
+
+                    template<typename FieldType>
+                    constexpr std::int64_t const safegcd_inversion<FieldType>::modulus_inverse;
+
+                    template<typename FieldType>
+                    constexpr typename safegcd_inversion<FieldType>::limbs_type const safegcd_inversion<FieldType>::r3;
+#else
+                    /// Requires fixed_montgomery_arithmetic, fields fall back to the generic inversion
+                    template<typename FieldType>
+                    struct safegcd_inversion;
+#endif
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_SAFEGCD_INVERSION_HPP
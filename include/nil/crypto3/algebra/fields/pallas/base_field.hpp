@@ -59,6 +59,10 @@ namespace nil {
 
                         0x40000000000000000000000000000000224698fc094cf91b992d30ed00000001_cppui255;
 
+                    /// Modulus limbs, least significant first, enables fixed_montgomery_arithmetic
+                    constexpr static const std::array<std::uint64_t, 4> montgomery_modulus_limbs = {
+                        0x992d30ed00000001, 0x224698fc094cf91b, 0x0000000000000000, 0x4000000000000000};
+
                     typedef typename policy_type::modular_backend modular_backend;
                     constexpr static const modular_params_type modulus_params = modulus;
                     typedef nil::crypto3::multiprecision::number<
@@ -78,6 +82,7 @@ namespace nil {
 #ifdef __ZKLLVM__
 #else
                 constexpr typename pallas_base_field::integral_type const pallas_base_field::modulus;
+                constexpr std::array<std::uint64_t, 4> const pallas_base_field::montgomery_modulus_limbs;
 #endif
 
                 using pallas_fq = pallas_base_field;
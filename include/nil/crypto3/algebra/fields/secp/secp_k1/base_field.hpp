@@ -142,6 +142,10 @@ namespace nil {
                     constexpr static const integral_type modulus =
                         0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_cppui256;
 
+                    /// Modulus limbs, least significant first, enables fixed_montgomery_arithmetic
+                    constexpr static const std::array<std::uint64_t, 4> montgomery_modulus_limbs = {
+                        0xfffffffefffffc2f, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff};
+
                     typedef typename policy_type::modular_backend modular_backend;
                     constexpr static const modular_params_type modulus_params = modulus;
                     typedef nil::crypto3::multiprecision::number<
@@ -183,6 +187,7 @@ namespace nil {
                 constexpr typename std::size_t const secp_k1_fq<256>::number_bits;
                 constexpr typename std::size_t const secp_k1_fq<256>::value_bits;
                 constexpr typename secp_k1_fq<256>::integral_type const secp_k1_fq<256>::modulus;
+                constexpr std::array<std::uint64_t, 4> const secp_k1_fq<256>::montgomery_modulus_limbs;
                 constexpr typename secp_k1_fq<256>::modular_params_type const secp_k1_fq<256>::modulus_params;
             }    // namespace fields
         }        // namespace algebra
@@ -143,6 +143,10 @@ namespace nil {
                     constexpr static const integral_type modulus =
                         0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141_cppui256;
 
+                    /// Modulus limbs, least significant first, enables fixed_montgomery_arithmetic
+                    constexpr static const std::array<std::uint64_t, 4> montgomery_modulus_limbs = {
+                        0xbfd25e8cd0364141, 0xbaaedce6af48a03b, 0xfffffffffffffffe, 0xffffffffffffffff};
+
                     typedef typename policy_type::modular_backend modular_backend;
                     constexpr static const modular_params_type modulus_params = modulus;
                     typedef nil::crypto3::multiprecision::number<
@@ -182,6 +186,7 @@ namespace nil {
                 constexpr typename std::size_t const secp_k1_fr<256>::number_bits;
                 constexpr typename std::size_t const secp_k1_fr<256>::value_bits;
                 constexpr typename secp_k1_fr<256>::integral_type const secp_k1_fr<256>::modulus;
+                constexpr std::array<std::uint64_t, 4> const secp_k1_fr<256>::montgomery_modulus_limbs;
                 constexpr typename secp_k1_fr<256>::modular_params_type const secp_k1_fr<256>::modulus_params;
             }    // namespace fields
         }        // namespace algebra
@@ -57,6 +57,10 @@ namespace nil {
                     constexpr static const integral_type modulus =
                         0x40000000000000000000000000000000224698fc0994a8dd8c46eb2100000001_cppui255;
 
+                    /// Modulus limbs, least significant first, enables fixed_montgomery_arithmetic
+                    constexpr static const std::array<std::uint64_t, 4> montgomery_modulus_limbs = {
+                        0x8c46eb2100000001, 0x224698fc0994a8dd, 0x0000000000000000, 0x4000000000000000};
+
                     typedef typename policy_type::modular_backend modular_backend;
                     constexpr static const modular_params_type modulus_params = modulus;
                     typedef nil::crypto3::multiprecision::number<
@@ -76,6 +80,7 @@ namespace nil {
 #ifdef __ZKLLVM__
 #else
                 constexpr typename vesta_base_field::integral_type const vesta_base_field::modulus;
+                constexpr std::array<std::uint64_t, 4> const vesta_base_field::montgomery_modulus_limbs;
 #endif
                 using vesta_fq = vesta_base_field;
             }    // namespace fields
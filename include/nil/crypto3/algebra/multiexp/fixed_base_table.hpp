@@ -0,0 +1,415 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_FIXED_BASE_TABLE_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_FIXED_BASE_TABLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/parallelization.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                /**
+                 * Fixed-width little-endian byte format of field elements, extension field elements are
+                 * written coefficient by coefficient.
+                 */
+                template<typename FieldValueType, typename = void>
+                struct field_element_octets {
+                    typedef typename FieldValueType::field_type field_type;
+
+                    constexpr static const std::size_t octets_num =
+                        field_type::modulus_bits / 8 + (field_type::modulus_bits % 8 ? 1 : 0);
+
+                    template<typename OutputIterator>
+                    static OutputIterator write(const FieldValueType &element, OutputIterator out) {
+                        std::array<std::uint8_t, octets_num> octets;
+                        octets.fill(0);
+                        multiprecision::export_bits(
+                            element.data.template convert_to<typename field_type::integral_type>(), octets.begin(), 8,
+                            false);
+                        return std::copy(octets.begin(), octets.end(), out);
+                    }
+
+                    /// Returns false if the integer read is not reduced
+                    template<typename InputIterator>
+                    static bool read(InputIterator &first, FieldValueType &element) {
+                        std::array<std::uint8_t, octets_num> octets;
+                        for (std::uint8_t &octet : octets) {
+                            octet = *first++;
+                        }
+
+                        typename field_type::integral_type value;
+                        multiprecision::import_bits(value, octets.begin(), octets.end(), 8, false);
+                        element = FieldValueType(value);
+                        return value < field_type::modulus;
+                    }
+                };
+
+                template<typename FieldValueType>
+                struct field_element_octets<FieldValueType,
+                                            typename std::enable_if<
+                                                is_extended_field_element<FieldValueType>::value>::type> {
+                    typedef typename FieldValueType::underlying_type underlying_type;
+                    typedef field_element_octets<underlying_type> underlying_octets;
+
+                    constexpr static const std::size_t octets_num =
+                        std::tuple_size<typename FieldValueType::data_type>::value * underlying_octets::octets_num;
+
+                    template<typename OutputIterator>
+                    static OutputIterator write(const FieldValueType &element, OutputIterator out) {
+                        for (const underlying_type &coefficient : element.data) {
+                            out = underlying_octets::write(coefficient, out);
+                        }
+                        return out;
+                    }
+
+                    template<typename InputIterator>
+                    static bool read(InputIterator &first, FieldValueType &element) {
+                        bool valid = true;
+                        for (underlying_type &coefficient : element.data) {
+                            valid = underlying_octets::read(first, coefficient) && valid;
+                        }
+                        return valid;
+                    }
+                };
+
+                /**
+                 * Storage of fixed-base table entries. By default the entries are group elements
+                 * and a lookup is an ordinary addition.
+                 */
+                template<typename GroupValueType, typename = void>
+                struct fixed_base_table_entry {
+                    typedef GroupValueType entry_type;
+
+                    constexpr static const bool is_serializable = false;
+
+                    template<typename OutputIterator>
+                    static void to_entries(std::vector<GroupValueType> &points, OutputIterator out) {
+                        std::copy(points.begin(), points.end(), out);
+                    }
+
+                    static GroupValueType add(const GroupValueType &acc, const entry_type &entry, bool negate) {
+                        return negate ? acc - entry : acc + entry;
+                    }
+                };
+
+                /**
+                 * Groups with a special form (short Weierstrass in jacobian or projective coordinates) keep
+                 * the entries as affine points, which is the special form without the Z coordinate, and
+                 * look them up with mixed addition.
+                 */
+                template<typename GroupValueType>
+                struct fixed_base_table_entry<
+                    GroupValueType,
+                    std::void_t<decltype(GroupValueType::batch_to_special_all_non_zeros(
+                        std::declval<std::vector<GroupValueType> &>()))>> {
+                    typedef decltype(std::declval<const GroupValueType &>().to_affine()) entry_type;
+                    typedef typename GroupValueType::field_type::value_type coordinate_type;
+                    typedef field_element_octets<coordinate_type> coordinate_octets;
+
+                    constexpr static const bool is_serializable = true;
+                    constexpr static const std::size_t octets_num = 2 * coordinate_octets::octets_num;
+
+                    template<typename OutputIterator>
+                    static void to_entries(std::vector<GroupValueType> &points, OutputIterator out) {
+                        batch_to_special(points);
+                        for (const GroupValueType &point : points) {
+                            *out++ = point.is_zero() ? entry_type::zero() : entry_type(point.X, point.Y);
+                        }
+                    }
+
+                    static GroupValueType add(const GroupValueType &acc, const entry_type &entry, bool negate) {
+                        if (entry.is_zero()) {
+                            return acc;
+                        }
+                        return acc.mixed_add(
+                            GroupValueType(entry.X, negate ? -entry.Y : entry.Y, coordinate_type::one()));
+                    }
+
+                    /// The point at infinity is written as its affine representation, i.e. the zero fill
+                    template<typename OutputIterator>
+                    static OutputIterator write(const entry_type &entry, OutputIterator out) {
+                        out = coordinate_octets::write(entry.X, out);
+                        return coordinate_octets::write(entry.Y, out);
+                    }
+
+                    template<typename InputIterator>
+                    static bool read(InputIterator &first, entry_type &entry) {
+                        bool valid = coordinate_octets::read(first, entry.X);
+                        return coordinate_octets::read(first, entry.Y) && valid;
+                    }
+                };
+            }    // namespace detail
+
+            /**
+             * @brief Table of multiples of a fixed base for repeated scalar multiplications by it.
+             *
+             * A scalar of scalar_size bits is recoded into scalar_size / window + 1 signed digits from
+             * [-2^(window-1) + 1, 2^(window-1)], so the table only keeps d * 2^(k * window) * g for
+             * d = 1, ..., 2^(window-1) and a negative digit uses the negated entry. The entries of all
+             * the windows are stored in a single vector, window after window; for short Weierstrass
+             * groups they are affine points added with mixed addition, see detail::fixed_base_table_entry.
+             * A multiplication is then one addition per window and no doublings.
+             */
+            template<typename GroupType>
+            class fixed_base_table {
+            public:
+                typedef GroupType group_type;
+                typedef typename group_type::value_type value_type;
+
+            private:
+                typedef detail::fixed_base_table_entry<value_type> entry_policy;
+
+                constexpr static const std::array<std::uint8_t, 8> magic = {'c', '3', 'f', 'b',
+                                                                            't', 'a', 'b', 'l'};
+                constexpr static const std::size_t header_octets_num = 32;
+
+                std::size_t scalar_bits;
+                std::size_t window_bits;
+                std::vector<typename entry_policy::entry_type> entries;
+
+                static void write_uint64(std::uint64_t value, std::uint8_t *out) {
+                    for (std::size_t i = 0; i < 8; ++i) {
+                        out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+                    }
+                }
+
+                template<typename InputIterator>
+                static std::uint64_t read_uint64(InputIterator &first) {
+                    std::uint64_t value = 0;
+                    for (std::size_t i = 0; i < 8; ++i) {
+                        value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(*first++)) << (8 * i);
+                    }
+                    return value;
+                }
+
+            public:
+                typedef typename entry_policy::entry_type entry_type;
+
+                fixed_base_table() : scalar_bits(0), window_bits(1) {
+                }
+
+                /**
+                 * Builds the table of g for scalars of scalar_size bits, the windows are split into
+                 * chunks_count slices computed through the executor.
+                 */
+                template<typename Executor>
+                fixed_base_table(const std::size_t scalar_size, const std::size_t window, const value_type &g,
+                                 const std::size_t chunks_count, Executor &&executor) :
+                    scalar_bits(scalar_size),
+                    window_bits(window) {
+                    BOOST_ASSERT(window >= 1 && window < 32);
+
+                    const std::size_t count = windows_count();
+                    const std::size_t half = window_entries_count();
+
+                    std::vector<value_type> window_bases(count, g);
+                    for (std::size_t k = 1; k < count; ++k) {
+                        for (std::size_t i = 0; i < window; ++i) {
+                            window_bases[k] = window_bases[k].doubled();
+                        }
+                    }
+
+                    entries.resize(count * half);
+
+                    detail::parallel_for_chunks(
+                        std::forward<Executor>(executor), count, chunks_count,
+                        [this, half, &window_bases](std::size_t begin, std::size_t end) {
+                            std::vector<value_type> points;
+                            points.reserve((end - begin) * half);
+
+                            for (std::size_t k = begin; k < end; ++k) {
+                                value_type multiple = window_bases[k];
+                                for (std::size_t d = 0; d < half; ++d) {
+                                    points.emplace_back(multiple);
+                                    multiple = multiple + window_bases[k];
+                                }
+                            }
+
+                            entry_policy::to_entries(points, entries.begin() + begin * half);
+                        });
+                }
+
+                fixed_base_table(const std::size_t scalar_size, const std::size_t window, const value_type &g) :
+                    fixed_base_table(scalar_size, window, g, default_chunks_count(), async_executor()) {
+                }
+
+                std::size_t scalar_size() const {
+                    return scalar_bits;
+                }
+
+                std::size_t window_size() const {
+                    return window_bits;
+                }
+
+                /// Number of signed digits a scalar is recoded into
+                std::size_t windows_count() const {
+                    return scalar_bits / window_bits + 1;
+                }
+
+                /// Number of entries per window, i.e. the largest digit
+                std::size_t window_entries_count() const {
+                    return std::size_t(1) << (window_bits - 1);
+                }
+
+                std::size_t size() const {
+                    return entries.size();
+                }
+
+                /// Multiplies the base by a scalar field element, which has to fit into scalar_size() bits
+                template<typename FieldValueType>
+                value_type exp(const FieldValueType &scalar) const {
+                    typedef typename FieldValueType::field_type::integral_type integral_type;
+
+                    const std::size_t half = window_entries_count();
+                    const integral_type window_mask = (integral_type(1) << window_bits) - 1;
+
+                    integral_type remainder = scalar.data.template convert_to<integral_type>();
+                    std::int64_t carry = 0;
+
+                    value_type result = value_type::zero();
+
+                    for (std::size_t k = 0; k < windows_count(); ++k) {
+                        std::int64_t digit =
+                            static_cast<std::int64_t>((remainder & window_mask).template convert_to<std::uint64_t>()) +
+                            carry;
+                        remainder >>= window_bits;
+
+                        carry = digit > static_cast<std::int64_t>(half) ? 1 : 0;
+                        digit -= carry << window_bits;
+
+                        if (digit > 0) {
+                            result = entry_policy::add(result, entries[k * half + digit - 1], false);
+                        } else if (digit < 0) {
+                            result = entry_policy::add(result, entries[k * half - digit - 1], true);
+                        }
+                    }
+
+                    BOOST_ASSERT(carry == 0 && remainder == 0);
+
+                    return result;
+                }
+
+                /**
+                 * Size of the byte image: a header of magic "c3fbtabl", scalar size, window size and entries
+                 * count as 64-bit little-endian integers, followed by the entries, each as the x and y
+                 * coordinates in fixed-width little-endian form.
+                 */
+                std::size_t octets_num() const {
+                    static_assert(entry_policy::is_serializable, "Table entries of the group have no byte format");
+                    return header_octets_num + entries.size() * entry_policy::octets_num;
+                }
+
+                /// Writes octets_num() bytes of the table, returns the iterator past the last written byte
+                template<typename OutputIterator>
+                OutputIterator to_bytes(OutputIterator out) const {
+                    static_assert(entry_policy::is_serializable, "Table entries of the group have no byte format");
+
+                    std::array<std::uint8_t, header_octets_num> header;
+                    std::copy(magic.begin(), magic.end(), header.begin());
+                    write_uint64(scalar_bits, header.data() + 8);
+                    write_uint64(window_bits, header.data() + 16);
+                    write_uint64(entries.size(), header.data() + 24);
+                    out = std::copy(header.begin(), header.end(), out);
+
+                    for (const entry_type &entry : entries) {
+                        out = entry_policy::write(entry, out);
+                    }
+
+                    return out;
+                }
+
+                /**
+                 * @brief Reads a table written by to_bytes, e.g. from a memory-mapped file.
+                 * The flag is false if the header does not match the size of the range or some integer is not
+                 * reduced. The entries are not checked to lie on the curve, the range is meant to be trusted.
+                 */
+                template<typename InputIterator>
+                static std::pair<bool, fixed_base_table> from_bytes(InputIterator first, InputIterator last) {
+                    static_assert(entry_policy::is_serializable, "Table entries of the group have no byte format");
+
+                    fixed_base_table result;
+
+                    const std::size_t available = std::distance(first, last);
+                    if (available < header_octets_num) {
+                        return std::make_pair(false, result);
+                    }
+
+                    for (std::uint8_t expected : magic) {
+                        if (static_cast<std::uint8_t>(*first++) != expected) {
+                            return std::make_pair(false, result);
+                        }
+                    }
+
+                    const std::uint64_t scalar_size = read_uint64(first);
+                    const std::uint64_t window = read_uint64(first);
+                    const std::uint64_t count = read_uint64(first);
+
+                    if (window < 1 || window >= 32) {
+                        return std::make_pair(false, result);
+                    }
+
+                    result.scalar_bits = scalar_size;
+                    result.window_bits = window;
+
+                    if (count != result.windows_count() * result.window_entries_count() ||
+                        available - header_octets_num != count * entry_policy::octets_num) {
+                        return std::make_pair(false, fixed_base_table());
+                    }
+
+                    bool valid = true;
+                    result.entries.resize(count);
+                    for (entry_type &entry : result.entries) {
+                        valid = entry_policy::read(first, entry) && valid;
+                    }
+
+                    return std::make_pair(valid, std::move(result));
+                }
+            };
+
+            template<typename GroupType>
+            constexpr std::array<std::uint8_t, 8> const fixed_base_table<GroupType>::magic;
+            template<typename GroupType>
+            constexpr std::size_t const fixed_base_table<GroupType>::header_octets_num;
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_FIXED_BASE_TABLE_HPP
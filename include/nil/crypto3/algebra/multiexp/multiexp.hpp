@@ -33,42 +33,67 @@
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/multiexp/fixed_base_table.hpp>
 #include <nil/crypto3/algebra/curves/params.hpp>
+#include <nil/crypto3/algebra/parallelization.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
-            template<typename MultiexpMethod, typename InputBaseIterator, typename InputFieldIterator>
+            /**
+             * Splits the input into chunks_count slices, evaluates MultiexpMethod over them through
+             * the executor and sums the partial results up in a fixed tree order, so the result
+             * does not depend on the way the slices were scheduled.
+             */
+            template<typename MultiexpMethod, typename InputBaseIterator, typename InputFieldIterator,
+                     typename Executor>
             typename std::iterator_traits<InputBaseIterator>::value_type
                 multiexp(InputBaseIterator vec_start, InputBaseIterator vec_end, InputFieldIterator scalar_start,
-                         InputFieldIterator scalar_end, const std::size_t chunks_count) {
+                         InputFieldIterator scalar_end, const std::size_t chunks_count, Executor &&executor) {
 
                 typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
-                typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
 
                 const std::size_t total_size = std::distance(vec_start, vec_end);
 
-                if ((total_size < chunks_count) || (chunks_count == 1)) {
+                if ((total_size < chunks_count) || (chunks_count <= 1)) {
                     // no need to split into "chunks_count", can call implementation directly
                     return MultiexpMethod::process(vec_start, vec_end, scalar_start, scalar_end);
                 }
 
-                const std::size_t one_chunk_size = total_size / chunks_count;
+                std::vector<base_value_type> partial_results = detail::parallel_chunks(
+                    std::forward<Executor>(executor), total_size, chunks_count,
+                    [vec_start, scalar_start](std::size_t begin, std::size_t end) {
+                        return MultiexpMethod::process(vec_start + begin, vec_start + end, scalar_start + begin,
+                                                       scalar_start + end);
+                    });
 
-                base_value_type result = base_value_type::zero();
+                return detail::tree_reduce(
+                    std::move(partial_results),
+                    [](const base_value_type &a, const base_value_type &b) { return a + b; });
+            }
 
-                for (std::size_t i = 0; i < chunks_count; ++i) {
-                    result =
-                        result + MultiexpMethod::process(
-                                     vec_start + i * one_chunk_size,
-                                     (i == chunks_count - 1 ? vec_end : vec_start + (i + 1) * one_chunk_size),
-                                     scalar_start + i * one_chunk_size,
-                                     (i == chunks_count - 1 ? scalar_end : scalar_start + (i + 1) * one_chunk_size));
-                }
+            template<typename MultiexpMethod, typename InputBaseIterator, typename InputFieldIterator>
+            typename std::iterator_traits<InputBaseIterator>::value_type
+                multiexp(InputBaseIterator vec_start, InputBaseIterator vec_end, InputFieldIterator scalar_start,
+                         InputFieldIterator scalar_end, const std::size_t chunks_count) {
 
-                return result;
+                return multiexp<MultiexpMethod>(vec_start, vec_end, scalar_start, scalar_end, chunks_count,
+                                                async_executor());
             }
 
+            template<typename MultiexpMethod, typename InputBaseIterator, typename InputFieldIterator>
+            typename std::iterator_traits<InputBaseIterator>::value_type
+                multiexp(InputBaseIterator vec_start, InputBaseIterator vec_end, InputFieldIterator scalar_start,
+                         InputFieldIterator scalar_end) {
+
+                return multiexp<MultiexpMethod>(vec_start, vec_end, scalar_start, scalar_end,
+                                                default_chunks_count());
+            }
+
+            /**
+             * When compiled with USE_MIXED_ADDITION, the bases are expected in special form,
+             * see batch_to_special.
+             */
             template<typename MultiexpMethod, typename InputBaseIterator, typename InputFieldIterator>
             typename std::iterator_traits<InputBaseIterator>::value_type
                 multiexp_with_mixed_addition(InputBaseIterator vec_start, InputBaseIterator vec_end,
@@ -109,11 +134,11 @@ namespace nil {
             }
 
             /**
-             * A window table stores window sizes for different instance sizes for fixed-base multi-scalar
-             * multiplications.
+             * A window table stores the multiples of a fixed base used by fixed-base scalar
+             * multiplications, see fixed_base_table.
              */
             template<typename GroupType>
-            using window_table = std::vector<std::vector<typename GroupType::value_type>>;
+            using window_table = fixed_base_table<GroupType>;
 
             template<typename GroupType>
             std::size_t get_exp_window_size(const std::size_t num_scalars) {
@@ -146,55 +171,42 @@ namespace nil {
             window_table<GroupType> get_window_table(const std::size_t scalar_size,
                                                      const std::size_t window,
                                                      const typename GroupType::value_type &g) {
-                const std::size_t in_window = 1ul << window;
-                const std::size_t outerc = (scalar_size + window - 1) / window;
-                const std::size_t last_in_window = 1ul << (scalar_size - (outerc - 1) * window);
-
-                window_table<GroupType> powers_of_g(
-                    outerc, std::vector<typename GroupType::value_type>(in_window, GroupType::value_type::zero()));
-
-                typename GroupType::value_type gouter = g;
-
-                for (std::size_t outer = 0; outer < outerc; ++outer) {
-                    typename GroupType::value_type ginner = GroupType::value_type::zero();
-                    std::size_t cur_in_window = outer == outerc - 1 ? last_in_window : in_window;
-                    for (std::size_t inner = 0; inner < cur_in_window; ++inner) {
-                        powers_of_g[outer][inner] = ginner;
-                        ginner = ginner + gouter;
-                    }
-
-                    for (std::size_t i = 0; i < window; ++i) {
-                        gouter = gouter.doubled();
-                    }
-                }
-
-                return powers_of_g;
+                return window_table<GroupType>(scalar_size, window, g);
             }
 
-            //
             template<typename GroupType, typename FieldType>
             typename GroupType::value_type windowed_exp(const std::size_t scalar_size,
                                                         const std::size_t window,
                                                         const window_table<GroupType> &powers_of_g,
                                                         const typename FieldType::value_type &pow) {
+                BOOST_ASSERT(scalar_size == powers_of_g.scalar_size() && window == powers_of_g.window_size());
 
-                typedef typename FieldType::modular_type modular_type;
+                return powers_of_g.exp(pow);
+            }
 
-                const std::size_t outerc = (scalar_size + window - 1) / window;
-                const modular_type pow_val = pow.data;
-                /* exp */
-                typename GroupType::value_type res = powers_of_g[0][0];
+            /**
+             * Multiplies the base of the table by every scalar of v, the scalars are split into
+             * chunks_count slices processed through the executor.
+             */
+            template<typename GroupType, typename FieldType, typename InputRange, typename Executor,
+                     typename = typename std::enable_if<
+                         std::is_same<typename InputRange::value_type, typename FieldType::value_type>::value>::type>
+            std::vector<typename GroupType::value_type> batch_exp(const std::size_t scalar_size,
+                                                                  const std::size_t window,
+                                                                  const window_table<GroupType> &table,
+                                                                  const InputRange &v,
+                                                                  const std::size_t chunks_count,
+                                                                  Executor &&executor) {
+                BOOST_ASSERT(scalar_size == table.scalar_size() && window == table.window_size());
 
-                for (std::size_t outer = 0; outer < outerc; ++outer) {
-                    std::size_t inner = 0;
-                    for (std::size_t i = 0; i < window; ++i) {
-                        if (multiprecision::bit_test(pow_val, outer * window + i)) {
-                            inner |= 1u << i;
-                        }
-                    }
+                std::vector<typename GroupType::value_type> res(std::distance(v.begin(), v.end()));
 
-                    res = res + powers_of_g[outer][inner];
-                }
+                detail::parallel_for_chunks(std::forward<Executor>(executor), res.size(), chunks_count,
+                                            [&table, &v, &res](std::size_t begin, std::size_t end) {
+                                                for (std::size_t i = begin; i < end; ++i) {
+                                                    res[i] = table.exp(v[i]);
+                                                }
+                                            });
 
                 return res;
             }
@@ -206,13 +218,8 @@ namespace nil {
                                                                   const std::size_t window,
                                                                   const window_table<GroupType> &table,
                                                                   const InputRange &v) {
-                std::vector<typename GroupType::value_type> res(std::distance(v.begin(), v.end()), table[0][0]);
-
-                for (std::size_t i = 0; i < v.size(); ++i) {
-                    res[i] = windowed_exp<GroupType, FieldType>(scalar_size, window, table, v[i]);
-                }
-
-                return res;
+                return batch_exp<GroupType, FieldType>(scalar_size, window, table, v, default_chunks_count(),
+                                                       async_executor());
             }
 
             template<typename GroupType, typename FieldType, typename InputRange,
@@ -224,39 +231,27 @@ namespace nil {
                                      const window_table<GroupType> &table,
                                      const typename FieldType::value_type &coeff,
                                      const InputRange &v) {
-                std::vector<typename GroupType::value_type> res(std::distance(v.begin(), v.end()), table[0][0]);
+                BOOST_ASSERT(scalar_size == table.scalar_size() && window == table.window_size());
 
-                for (std::size_t i = 0; i < v.size(); ++i) {
-                    res[i] = windowed_exp<GroupType, FieldType>(scalar_size, window, table, coeff * v[i]);
-                }
+                std::vector<typename GroupType::value_type> res(std::distance(v.begin(), v.end()));
+
+                detail::parallel_for_chunks(async_executor(), res.size(), default_chunks_count(),
+                                            [&table, &coeff, &v, &res](std::size_t begin, std::size_t end) {
+                                                for (std::size_t i = begin; i < end; ++i) {
+                                                    res[i] = table.exp(coeff * v[i]);
+                                                }
+                                            });
 
                 return res;
             }
 
+            /// Overload taking the group type explicitly, see batch_to_special(InputRange &)
             template<typename GroupType, typename InputRange>
             typename std::enable_if<
                 std::is_same<typename InputRange::value_type, typename GroupType::value_type>::value, void>::type
                 batch_to_special(InputRange &vec) {
 
-                std::vector<typename GroupType::value_type> non_zero_vec;
-                for (std::size_t i = 0; i < vec.size(); ++i) {
-                    if (!vec[i].is_zero()) {
-                        non_zero_vec.emplace_back(vec[i]);
-                    }
-                }
-
-                GroupType::batch_to_special_all_non_zeros(non_zero_vec);
-                typename std::vector<typename GroupType::value_type>::const_iterator it = non_zero_vec.begin();
-                typename GroupType::value_type zero_special = GroupType::value_type::zero().to_projective();
-
-                for (std::size_t i = 0; i < vec.size(); ++i) {
-                    if (!vec[i].is_zero()) {
-                        vec[i] = *it;
-                        ++it;
-                    } else {
-                        vec[i] = zero_special;
-                    }
-                }
+                batch_to_special(vec);
             }
         }    // namespace algebra
     }        // namespace crypto3
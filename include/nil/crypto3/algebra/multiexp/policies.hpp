@@ -27,16 +27,49 @@
 #ifndef CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 #define CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 
 #include <nil/crypto3/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
 #include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/fields/detail/batch_inversion.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
+            /**
+             * Brings the points of the vector to special form, i.e. Z = 1 for every non-zero point,
+             * which is what mixed addition expects as its second operand. The non-zero points share
+             * a single field inversion.
+             */
+            template<typename InputRange>
+            void batch_to_special(InputRange &vec) {
+                typedef typename InputRange::value_type value_type;
+
+                std::vector<value_type> non_zero_vec;
+                for (std::size_t i = 0; i < vec.size(); ++i) {
+                    if (!vec[i].is_zero()) {
+                        non_zero_vec.emplace_back(vec[i]);
+                    }
+                }
+
+                value_type::batch_to_special_all_non_zeros(non_zero_vec);
+                typename std::vector<value_type>::const_iterator it = non_zero_vec.begin();
+
+                for (std::size_t i = 0; i < vec.size(); ++i) {
+                    if (!vec[i].is_zero()) {
+                        vec[i] = *it;
+                        ++it;
+                    } else {
+                        vec[i] = value_type::zero();
+                    }
+                }
+            }
+
             namespace policies {
                 namespace detail {
                     template<typename NumberType>
@@ -54,6 +87,37 @@ namespace nil {
                             return (this->r < other.r);
                         }
                     };
+
+                    /**
+                     * Powers of Z the X and Y coordinates of a short Weierstrass point are scaled by
+                     * in the given coordinates representation, i.e. x = X / Z^x_power, y = Y / Z^y_power.
+                     */
+                    template<typename Coordinates>
+                    struct short_weierstrass_z_powers;
+
+                    template<>
+                    struct short_weierstrass_z_powers<curves::coordinates::jacobian> {
+                        constexpr static const std::size_t x_power = 2;
+                        constexpr static const std::size_t y_power = 3;
+                    };
+
+                    template<>
+                    struct short_weierstrass_z_powers<curves::coordinates::jacobian_with_a4_0>
+                        : public short_weierstrass_z_powers<curves::coordinates::jacobian> { };
+
+                    template<>
+                    struct short_weierstrass_z_powers<curves::coordinates::jacobian_with_a4_minus_3>
+                        : public short_weierstrass_z_powers<curves::coordinates::jacobian> { };
+
+                    template<>
+                    struct short_weierstrass_z_powers<curves::coordinates::projective> {
+                        constexpr static const std::size_t x_power = 1;
+                        constexpr static const std::size_t y_power = 1;
+                    };
+
+                    template<>
+                    struct short_weierstrass_z_powers<curves::coordinates::projective_with_a4_minus_3>
+                        : public short_weierstrass_z_powers<curves::coordinates::projective> { };
                 }    // namespace detail
 
                 /**
@@ -93,9 +157,9 @@ namespace nil {
                  * Bernstein, Doumen, Lange, Oosterwijk,
                  * "Faster batch forgery identification", INDOCRYPT 2012
                  * (https://eprint.iacr.org/2012/549.pdf)
-                 * When compiled with USE_MIXED_ADDITION, assumes input is in special form.
-                 * Requires that base_value_type implements .dbl() (and, if USE_MIXED_ADDITION is defined,
-                 * .to_projective(), .mixed_add(), and batch_to_projective()).
+                 * When compiled with USE_MIXED_ADDITION, assumes input is in special form (see batch_to_special).
+                 * Requires that base_value_type implements .doubled() (and, if USE_MIXED_ADDITION is defined,
+                 * .mixed_add() and batch_to_special_all_non_zeros()).
                  */
                 struct multiexp_method_BDLO12 {
                     template<typename InputBaseIterator, typename InputFieldIterator>
@@ -205,6 +269,214 @@ namespace nil {
                     }
                 };
 
+                /**
+                 * Pippenger's bucket method with signed window digits and buckets kept in affine
+                 * coordinates, for large instances.
+                 *
+                 * Every scalar is recoded once into digits from [-2^(c-1) + 1, 2^(c-1)], so a window
+                 * needs 2^(c-1) buckets and a negative digit adds the negated base. Points are added
+                 * to the buckets in batches of independent affine additions, whose denominators are
+                 * inverted together with Montgomery's trick. Additions which can not be done in affine
+                 * form (equal abscissas) go to a projective spill-over bucket.
+                 *
+                 * Requires short Weierstrass bases in jacobian or projective coordinates.
+                 */
+                struct multiexp_method_signed_batch_affine {
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process(InputBaseIterator bases,
+                                InputBaseIterator bases_end,
+                                InputFieldIterator exponents,
+                                InputFieldIterator exponents_end) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                        typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
+                        typedef typename field_value_type::field_type scalar_field_type;
+                        typedef typename scalar_field_type::integral_type integral_type;
+                        typedef typename base_value_type::field_type::value_type coordinate_type;
+                        typedef detail::short_weierstrass_z_powers<typename base_value_type::coordinates> z_powers;
+
+                        const std::size_t length = std::distance(bases, bases_end);
+
+                        BOOST_ASSERT(length == std::distance(exponents, exponents_end));
+
+                        if (length == 0) {
+                            return base_value_type::zero();
+                        }
+
+                        std::size_t log2_length = 0;
+                        while ((std::size_t(1) << (log2_length + 1)) <= length) {
+                            ++log2_length;
+                        }
+
+                        const std::size_t c = length < 32 ? 3 : (log2_length * 69) / 100 + 2;
+                        const std::size_t buckets_count = std::size_t(1) << (c - 1);
+                        const std::size_t windows_count = scalar_field_type::modulus_bits / c + 1;
+
+                        // Signed digits, window-major: digits[k * length + i] is the k-th digit of i-th scalar
+                        std::vector<std::int32_t> digits(windows_count * length);
+                        const integral_type window_mask = (integral_type(1) << c) - 1;
+
+                        for (std::size_t i = 0; i < length; ++i) {
+                            integral_type scalar = exponents[i].data.template convert_to<integral_type>();
+                            std::int32_t carry = 0;
+
+                            for (std::size_t k = 0; k < windows_count; ++k) {
+                                std::int32_t digit =
+                                    static_cast<std::int32_t>((scalar & window_mask).template convert_to<std::uint64_t>()) +
+                                    carry;
+                                scalar >>= c;
+
+                                carry = digit > static_cast<std::int32_t>(buckets_count) ? 1 : 0;
+                                digits[k * length + i] = digit - (carry << c);
+                            }
+
+                            BOOST_ASSERT(carry == 0);
+                        }
+
+                        // Bases in affine coordinates, one shared inversion for all of them
+                        std::vector<coordinate_type> xs(length), ys(length);
+                        std::vector<bool> base_nonzero(length);
+                        std::vector<coordinate_type> denominators, prefix_products;
+
+                        for (std::size_t i = 0; i < length; ++i) {
+                            base_nonzero[i] = !bases[i].is_zero();
+                            if (base_nonzero[i]) {
+                                denominators.emplace_back(bases[i].Z);
+                            }
+                        }
+
+                        fields::detail::batch_invert_non_zeros(denominators, prefix_products);
+
+                        for (std::size_t i = 0, j = 0; i < length; ++i) {
+                            if (!base_nonzero[i]) {
+                                continue;
+                            }
+                            const coordinate_type &z_inv = denominators[j++];
+                            const coordinate_type z_inv_squared = z_inv.squared();
+                            xs[i] = bases[i].X * (z_powers::x_power == 2 ? z_inv_squared : z_inv);
+                            ys[i] = bases[i].Y * (z_powers::y_power == 3 ? z_inv_squared * z_inv : z_inv);
+                        }
+
+                        struct pending_addition {
+                            std::size_t bucket;
+                            coordinate_type x;
+                            coordinate_type y;
+                        };
+
+                        // Batches of fewer additions than that do not pay off the inversion
+                        const std::size_t min_batch_size = 16;
+
+                        std::vector<coordinate_type> bucket_x(buckets_count), bucket_y(buckets_count);
+                        std::vector<bool> bucket_nonzero(buckets_count);
+                        std::vector<base_value_type> spill_buckets(buckets_count);
+                        std::vector<std::size_t> bucket_batch(buckets_count);
+                        std::vector<pending_addition> additions;
+                        std::vector<std::size_t> queue, deferred;
+                        std::size_t batch = 0;
+
+                        base_value_type result = base_value_type::zero();
+
+                        for (std::size_t k = windows_count - 1; k < windows_count; --k) {
+                            if (!result.is_zero()) {
+                                for (std::size_t i = 0; i < c; ++i) {
+                                    result = result.doubled();
+                                }
+                            }
+
+                            std::fill(bucket_nonzero.begin(), bucket_nonzero.end(), false);
+                            std::fill(spill_buckets.begin(), spill_buckets.end(), base_value_type::zero());
+
+                            const std::int32_t *window_digits = digits.data() + k * length;
+
+                            queue.clear();
+                            for (std::size_t i = 0; i < length; ++i) {
+                                if (window_digits[i] != 0 && base_nonzero[i]) {
+                                    queue.push_back(i);
+                                }
+                            }
+
+                            while (!queue.empty()) {
+                                ++batch;
+                                additions.clear();
+                                denominators.clear();
+                                deferred.clear();
+
+                                for (std::size_t i : queue) {
+                                    const std::int32_t digit = window_digits[i];
+                                    const std::size_t b = (digit > 0 ? digit : -digit) - 1;
+
+                                    if (bucket_batch[b] == batch) {
+                                        // the bucket is already a summand in this batch
+                                        deferred.push_back(i);
+                                        continue;
+                                    }
+
+                                    const coordinate_type y = digit > 0 ? ys[i] : -ys[i];
+
+                                    if (!bucket_nonzero[b]) {
+                                        bucket_x[b] = xs[i];
+                                        bucket_y[b] = y;
+                                        bucket_nonzero[b] = true;
+                                    } else if (bucket_x[b] == xs[i]) {
+                                        // doubling or cancellation, not worth a special affine formula
+                                        spill_buckets[b] = spill_buckets[b] +
+                                                           base_value_type(xs[i], y, coordinate_type::one());
+                                    } else {
+                                        bucket_batch[b] = batch;
+                                        denominators.emplace_back(xs[i] - bucket_x[b]);
+                                        additions.push_back({b, xs[i], y});
+                                    }
+                                }
+
+                                fields::detail::batch_invert_non_zeros(denominators, prefix_products);
+
+                                for (std::size_t j = 0; j < additions.size(); ++j) {
+                                    const pending_addition &addition = additions[j];
+                                    coordinate_type &x1 = bucket_x[addition.bucket];
+                                    coordinate_type &y1 = bucket_y[addition.bucket];
+
+                                    const coordinate_type lambda = (addition.y - y1) * denominators[j];
+                                    const coordinate_type x3 = lambda.squared() - x1 - addition.x;
+                                    y1 = lambda * (x1 - x3) - y1;
+                                    x1 = x3;
+                                }
+
+                                if (!deferred.empty() && additions.size() < min_batch_size) {
+                                    for (std::size_t i : deferred) {
+                                        const std::int32_t digit = window_digits[i];
+                                        const std::size_t b = (digit > 0 ? digit : -digit) - 1;
+                                        spill_buckets[b] =
+                                            spill_buckets[b] +
+                                            base_value_type(xs[i], digit > 0 ? ys[i] : -ys[i], coordinate_type::one());
+                                    }
+                                    deferred.clear();
+                                }
+
+                                queue.swap(deferred);
+                            }
+
+                            base_value_type running_sum = base_value_type::zero();
+                            base_value_type window_sum = base_value_type::zero();
+
+                            for (std::size_t b = buckets_count - 1; b < buckets_count; --b) {
+                                if (bucket_nonzero[b]) {
+                                    running_sum =
+                                        running_sum + base_value_type(bucket_x[b], bucket_y[b], coordinate_type::one());
+                                }
+                                if (!spill_buckets[b].is_zero()) {
+                                    running_sum = running_sum + spill_buckets[b];
+                                }
+                                window_sum = window_sum + running_sum;
+                            }
+
+                            result = result + window_sum;
+                        }
+
+                        return result;
+                    }
+                };
+
                 /**
                  * A variant of the Bos-Coster algorithm [1],
                  * with implementation suggestions from [2].
@@ -31,8 +31,10 @@
 #include <nil/crypto3/algebra/pairing/detail/bls12/381/params.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_double_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_multi_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precompute_g1.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precompute_g2.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precomputed_g2_marshalling.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/final_exponentiation.hpp>
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
@@ -52,11 +54,16 @@ namespace nil {
                     using miller_loop = pairing::short_weierstrass_jacobian_with_a4_0_ate_miller_loop<curve_type>;
                     using double_miller_loop =
                         pairing::short_weierstrass_jacobian_with_a4_0_ate_double_miller_loop<curve_type>;
+                    using multi_miller_loop =
+                        pairing::short_weierstrass_jacobian_with_a4_0_ate_multi_miller_loop<curve_type>;
                     using final_exponentiation =
                         pairing::short_weierstrass_jacobian_with_a4_0_final_exponentiation<curve_type>;
 
                     using g1_precomputed_type = typename precompute_g1::g1_precomputed_type;
                     using g2_precomputed_type = typename precompute_g2::g2_precomputed_type;
+
+                    using precomputed_g2_marshalling =
+                        pairing::short_weierstrass_jacobian_with_a4_0_ate_precomputed_g2_marshalling<curve_type>;
                 };
 
             }    // namespace pairing
@@ -27,6 +27,8 @@
 #define CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_PAIRING_PARAMS_HPP
 
 #include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/twist_type.hpp>
+#include <nil/crypto3/algebra/pairing/detail/miller_loop_schedule.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -48,17 +50,36 @@ namespace nil {
                         constexpr static const std::size_t integral_type_max_bits =
                             curve_type::base_field_type::modulus_bits;
 
+                        /// 6z + 2 of the optimal ate pairing
                         constexpr static const integral_type ate_loop_count = 0x19D797039BE763BA8_cppui254;
                         constexpr static const bool ate_is_loop_count_neg = false;
+                        /// Digits of ate_loop_count driving the Miller loops
+                        typedef miller_loop_schedule<0x9D797039BE763BA8, 0x1> ate_loop_schedule;
+                        constexpr static const bool ate_loop_is_naf = true;
+                        constexpr static const bool ate_has_frobenius_steps = true;
                         constexpr static const extended_integral_type final_exponent = extended_integral_type(
                             0x2F4B6DC97020FDDADF107D20BC842D43BF6369B1FF6A1C71015F3F7BE2E1E30A73BB94FEC0DAF15466B2383A5D3EC3D15AD524D8F70C54EFEE1BD8C3B21377E563A09A1B705887E72ECEADDEA3790364A61F676BAAF977870E88D5C6C8FEF0781361E443AE77F5B63A2A2264487F2940A8B1DDB3D15062CD0FB2015DFC6668449AED3CC48A82D0D602D268C7DAAB6A41294C0CC4EBE5664568DFC50E1648A45A4A1E3A5195846A3ED011A337A02088EC80E0EBAE8755CFE107ACF3AAFB40494E406F804216BB10CF430B0F37856B42DB8DC5514724EE93DFB10826F0DD4A0364B9580291D2CD65664814FDE37CA80BB4EA44EACC5E641BBADF423F9A2CBF813B8D145DA90029BAEE7DDADDA71C7F3811C4105262945BBA1668C3BE69A3C230974D83561841D766F9C9D570BB7FBE04C7E8A6C3C760C0DE81DEF35692DA361102B6B9B2B918837FA97896E84ABB40A4EFB7E54523A486964B64CA86F120_cppui2790);
 
                         constexpr static const integral_type final_exponent_z = integral_type(0x44E992B44A6909F1);
-                        constexpr static const integral_type final_exponent_is_z_neg = false;
+                        constexpr static const bool final_exponent_is_z_neg = false;
 
-                        using g2_field_type_value = typename curve_type::g2_type::field_type::value_type;
+                        using g2_field_type_value = typename curve_type::template g2_type<>::field_type::value_type;
 
-                        constexpr static const g2_field_type_value twist = g2_type::params_type::twist;
+                        constexpr static const twist_type twist_kind = twist_type::d_type;
+
+                        constexpr static const g2_field_type_value twist =
+                            curve_type::template g2_type<>::params_type::twist;
+
+                        constexpr static const g2_field_type_value twist_coeff_b =
+                            curve_type::template g2_type<>::params_type::b;
+
+                        /// pi(x, y) = (twist_frobenius_x * x^p, twist_frobenius_y * y^p) on the twist
+                        constexpr static const g2_field_type_value twist_frobenius_x =
+                            curves::detail::subgroup_check_params<
+                                typename curve_type::template g2_type<>::params_type>::psi_x;
+                        constexpr static const g2_field_type_value twist_frobenius_y =
+                            curves::detail::subgroup_check_params<
+                                typename curve_type::template g2_type<>::params_type>::psi_y;
                     };
 
                     constexpr typename pairing_params<curves::alt_bn128<254>>::integral_type const
@@ -70,8 +91,20 @@ namespace nil {
                     constexpr typename pairing_params<curves::alt_bn128<254>>::extended_integral_type const
                         pairing_params<curves::alt_bn128<254>>::final_exponent;
 
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::twist;
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::twist_coeff_b;
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::twist_frobenius_x;
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::twist_frobenius_y;
+
                     constexpr bool const pairing_params<curves::alt_bn128<254>>::ate_is_loop_count_neg;
+                    constexpr bool const pairing_params<curves::alt_bn128<254>>::ate_loop_is_naf;
+                    constexpr bool const pairing_params<curves::alt_bn128<254>>::ate_has_frobenius_steps;
                     constexpr bool const pairing_params<curves::alt_bn128<254>>::final_exponent_is_z_neg;
+                    constexpr twist_type const pairing_params<curves::alt_bn128<254>>::twist_kind;
 
                 }    // namespace detail
             }        // namespace pairing
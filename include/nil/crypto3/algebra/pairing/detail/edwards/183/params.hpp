@@ -27,6 +27,7 @@
 #define CRYPTO3_ALGEBRA_PAIRING_EDWARDS_183_PAIRING_PARAMS_HPP
 
 #include <nil/crypto3/algebra/curves/edwards.hpp>
+#include <nil/crypto3/algebra/pairing/detail/miller_loop_schedule.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -50,6 +51,11 @@ namespace nil {
 
                         constexpr static const integral_type ate_loop_count =
                             integral_type(0xE841DEEC0A9E39280000003_cppui92);
+                        /// Digits of ate_loop_count driving the Miller loops
+                        typedef miller_loop_schedule<0xC0A9E39280000003, 0x0E841DEE> ate_loop_schedule;
+                        /// Digits of the scalar field modulus driving the Tate Miller loops
+                        typedef miller_loop_schedule<0x1DE5532780000001, 0xC4E2E493B92E12CC, 0x10357F274A8E56>
+                            tate_loop_schedule;
 
                         constexpr static const integral_type final_exponent_last_chunk_abs_of_w0 =
                             integral_type(0x3A1077BB02A78E4A00000003_cppui94);
@@ -27,6 +27,8 @@
 #define CRYPTO3_ALGEBRA_PAIRING_EDWARDS_183_TYPES_POLICY_HPP
 
 #include <nil/crypto3/algebra/curves/edwards.hpp>
+#include <nil/crypto3/algebra/pairing/detail/edwards/183/params.hpp>
+#include <nil/crypto3/algebra/pairing/detail/precomputed_coeffs.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -42,6 +44,9 @@ namespace nil {
                     class types_policy<curves::edwards<183>> {
                         using curve_type = curves::edwards<183>;
 
+                        using ate_schedule_type = pairing_params<curve_type>::ate_loop_schedule;
+                        using tate_schedule_type = pairing_params<curve_type>::tate_loop_schedule;
+
                     public:
                         using integral_type = typename curve_type::base_field_type::integral_type;
                         using extended_integral_type = typename curve_type::base_field_type::extended_integral_type;
@@ -72,8 +77,12 @@ namespace nil {
                             }
                         };
 
-                        using tate_g1_precomp = std::vector<Fq_conic_coefficients>;
-                        using ate_g2_precomputed_type = std::vector<Fq3_conic_coefficients>;
+                        using tate_g1_precomp =
+                            precomputed_coeffs<Fq_conic_coefficients, tate_schedule_type::binary.size() +
+                                                                          tate_schedule_type::binary_additions_count>;
+                        using ate_g2_precomputed_type =
+                            precomputed_coeffs<Fq3_conic_coefficients, ate_schedule_type::binary.size() +
+                                                                           ate_schedule_type::binary_additions_count>;
 
                         struct ate_g1_precomputed_type {
                             g1_field_value_type P_XY;
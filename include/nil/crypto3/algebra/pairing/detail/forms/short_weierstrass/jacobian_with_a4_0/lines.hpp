@@ -0,0 +1,94 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_LINES_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_LINES_HPP
+
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/twist_type.hpp>
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+                namespace detail {
+
+                    template<typename CurveType>
+                    class pairing_params;
+
+                    /**
+                     * @brief Evaluation of precomputed ate_ell_coeffs at G1 point and multiplication of
+                     * Miller loop accumulator by the resulting sparse lines, dispatched on the twist kind.
+                     */
+                    template<typename CurveType>
+                    class short_weierstrass_jacobian_with_a4_0_ate_lines {
+                        using curve_type = CurveType;
+
+                        using params_type = pairing_params<curve_type>;
+                        typedef short_weierstrass_jacobian_with_a4_0_types_policy<curve_type> policy_type;
+
+                        using gt_value_type = typename curve_type::gt_type::value_type;
+
+                    public:
+                        constexpr static const twist_type twist_kind = twist_type_of<params_type>::value;
+
+                        /// f * l(P)
+                        static gt_value_type mul_by_line(const gt_value_type &f,
+                                                         const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                                         const typename policy_type::ate_ell_coeffs &c) {
+                            if constexpr (twist_kind == twist_type::d_type) {
+                                return f.mul_by_024(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
+                            } else {
+                                return f.mul_by_045(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
+                            }
+                        }
+
+                        /// f * l1(P1) * l2(P2), lines are multiplied together first
+                        static gt_value_type mul_by_lines(const gt_value_type &f,
+                                                          const typename policy_type::ate_g1_precomputed_type &prec_P1,
+                                                          const typename policy_type::ate_ell_coeffs &c1,
+                                                          const typename policy_type::ate_g1_precomputed_type &prec_P2,
+                                                          const typename policy_type::ate_ell_coeffs &c2) {
+                            if constexpr (twist_kind == twist_type::d_type) {
+                                return f.mul_by_01234(gt_value_type::mul_024_by_024(
+                                    c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV, c2.ell_0,
+                                    prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV));
+                            } else {
+                                return f.mul_by_01245(gt_value_type::mul_045_by_045(
+                                    c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV, c2.ell_0,
+                                    prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV));
+                            }
+                        }
+                    };
+
+                    template<typename CurveType>
+                    constexpr twist_type const short_weierstrass_jacobian_with_a4_0_ate_lines<CurveType>::twist_kind;
+
+                }    // namespace detail
+            }        // namespace pairing
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_LINES_HPP
@@ -26,12 +26,18 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_TYPES_POLICY_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_TYPES_POLICY_HPP
 
+#include <nil/crypto3/algebra/pairing/detail/miller_loop_schedule.hpp>
+#include <nil/crypto3/algebra/pairing/detail/precomputed_coeffs.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace pairing {
                 namespace detail {
 
+                    template<typename CurveType>
+                    class pairing_params;
+
                     template<typename CurveType>
                     class short_weierstrass_jacobian_with_a4_0_types_policy {
                         using curve_type = CurveType;
@@ -43,6 +49,10 @@ namespace nil {
                         using g1_field_value_type = typename curve_type::base_field_type::value_type;
                         using g2_field_value_type = typename curve_type::template g2_type<>::field_type::value_type;
 
+                        /// One line per doubling step and one per addition step of the Miller loop
+                        constexpr static const std::size_t ate_coeffs_count =
+                            ate_loop<pairing_params<curve_type>>::coeffs_count;
+
                         struct ate_g1_precomputed_type {
 
                             g1_field_value_type PX;
@@ -70,7 +80,7 @@ namespace nil {
 
                             g2_field_value_type QX;
                             g2_field_value_type QY;
-                            std::vector<coeffs_type> coeffs;
+                            precomputed_coeffs<coeffs_type, ate_coeffs_count> coeffs;
 
                             bool operator==(const ate_g2_precomputed_type &other) const {
                                 return (this->QX == other.QX && this->QY == other.QY && this->coeffs == other.coeffs);
@@ -26,15 +26,22 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_PROJECTIVE_TYPES_POLICY_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_PROJECTIVE_TYPES_POLICY_HPP
 
+#include <nil/crypto3/algebra/pairing/detail/precomputed_coeffs.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace pairing {
                 namespace detail {
 
+                    template<typename CurveType>
+                    class pairing_params;
+
                     template<typename CurveType>
                     class short_weierstrass_projective_types_policy {
                         using curve_type = CurveType;
+                        using params_type = pairing_params<curve_type>;
+                        using schedule_type = typename params_type::ate_loop_schedule;
 
                     public:
                         using integral_type = typename curve_type::base_field_type::integral_type;
@@ -43,6 +50,13 @@ namespace nil {
                         using g1_field_value_type = typename curve_type::base_field_type::value_type;
                         using g2_field_value_type = typename curve_type::template g2_type<>::field_type::value_type;
 
+                        constexpr static const std::size_t affine_ate_coeffs_count =
+                            schedule_type::naf.size() + schedule_type::naf_additions_count;
+                        constexpr static const std::size_t ate_dbl_coeffs_count = schedule_type::binary.size();
+                        /// A negative loop count takes one more addition step to negate the result
+                        constexpr static const std::size_t ate_add_coeffs_count =
+                            schedule_type::binary_additions_count + (params_type::ate_is_loop_count_neg ? 1 : 0);
+
                         struct affine_ate_g1_precomputation {
                             g1_field_value_type PX;
                             g1_field_value_type PY;
@@ -61,7 +75,7 @@ namespace nil {
                         struct affine_ate_g2_precomputation {
                             g2_field_value_type QX;
                             g2_field_value_type QY;
-                            std::vector<affine_ate_coeffs> coeffs;
+                            precomputed_coeffs<affine_ate_coeffs, affine_ate_coeffs_count> coeffs;
                         };
 
                         /* ate pairing */
@@ -113,8 +127,8 @@ namespace nil {
                             g2_field_value_type QY2;
                             g2_field_value_type QX_over_twist;
                             g2_field_value_type QY_over_twist;
-                            std::vector<dbl_coeffs_type> dbl_coeffs;
-                            std::vector<add_coeffs_type> add_coeffs;
+                            precomputed_coeffs<dbl_coeffs_type, ate_dbl_coeffs_count> dbl_coeffs;
+                            precomputed_coeffs<add_coeffs_type, ate_add_coeffs_count> add_coeffs;
 
                             bool operator==(const ate_g2_precomputed_type &other) const {
                                 return (this->QX == other.QX && this->QY == other.QY && this->QY2 == other.QY2 &&
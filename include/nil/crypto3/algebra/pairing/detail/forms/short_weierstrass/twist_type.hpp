@@ -0,0 +1,59 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_TWIST_TYPE_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_TWIST_TYPE_HPP
+
+#include <type_traits>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+                namespace detail {
+
+                    /**
+                     * @brief Kind of the sextic twist E'/Fp2 used for G2.
+                     *
+                     * For M-type twist (E': y^2 = x^3 + b * xi) Miller loop lines are sparse at
+                     * positions 0, 4, 5 of Fp12 (mul_by_045), for D-type twist (E': y^2 = x^3 + b / xi)
+                     * at positions 0, 2, 4 (mul_by_024).
+                     */
+                    enum class twist_type { m_type, d_type };
+
+                    /// Twist kind of the pairing parameters, M-type unless twist_kind is specified
+                    template<typename PairingParams, typename = void>
+                    struct twist_type_of : std::integral_constant<twist_type, twist_type::m_type> { };
+
+                    template<typename PairingParams>
+                    struct twist_type_of<PairingParams, std::void_t<decltype(PairingParams::twist_kind)>>
+                        : std::integral_constant<twist_type, PairingParams::twist_kind> { };
+
+                }    // namespace detail
+            }        // namespace pairing
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_TWIST_TYPE_HPP
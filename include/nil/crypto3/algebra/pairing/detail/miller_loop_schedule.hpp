@@ -0,0 +1,221 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_MILLER_LOOP_SCHEDULE_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_MILLER_LOOP_SCHEDULE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+                namespace detail {
+                    typedef std::int8_t miller_loop_digit_type;
+
+                    template<std::size_t WordsCount>
+                    constexpr std::size_t loop_count_bits(const std::array<std::uint64_t, WordsCount> &words) {
+                        for (std::size_t i = WordsCount - 1; i < WordsCount; --i) {
+                            for (std::size_t j = 63; j < 64; --j) {
+                                if ((words[i] >> j) & 1) {
+                                    return 64 * i + j + 1;
+                                }
+                            }
+                        }
+                        return 0;
+                    }
+
+                    /// Non-adjacent form of the loop count, least significant digit first
+                    template<std::size_t WordsCount>
+                    constexpr std::array<miller_loop_digit_type, 64 * WordsCount + 1>
+                        loop_count_naf(const std::array<std::uint64_t, WordsCount> &words) {
+                        std::array<std::uint64_t, WordsCount + 1> c = {};
+                        for (std::size_t i = 0; i < WordsCount; ++i) {
+                            c[i] = words[i];
+                        }
+
+                        std::array<miller_loop_digit_type, 64 * WordsCount + 1> result = {};
+                        for (std::size_t i = 0; i < result.size(); ++i) {
+                            if (c[0] & 1) {
+                                if ((c[0] & 3) == 1) {
+                                    result[i] = 1;
+                                    c[0] -= 1;
+                                } else {
+                                    result[i] = -1;
+                                    for (std::size_t j = 0; j < c.size() && ++c[j] == 0; ++j) {
+                                    }
+                                }
+                            }
+
+                            for (std::size_t j = 0; j < c.size(); ++j) {
+                                c[j] = (c[j] >> 1) | (j + 1 < c.size() ? c[j + 1] << 63 : 0);
+                            }
+                        }
+                        return result;
+                    }
+
+                    template<std::size_t DigitsCount>
+                    constexpr std::size_t
+                        naf_length(const std::array<miller_loop_digit_type, DigitsCount> &naf) {
+                        for (std::size_t i = DigitsCount - 1; i < DigitsCount; --i) {
+                            if (naf[i] != 0) {
+                                return i + 1;
+                            }
+                        }
+                        return 0;
+                    }
+
+                    template<std::size_t StepsCount, std::size_t WordsCount>
+                    constexpr std::array<miller_loop_digit_type, StepsCount>
+                        binary_loop_steps(const std::array<std::uint64_t, WordsCount> &words) {
+                        std::array<miller_loop_digit_type, StepsCount> result = {};
+                        for (std::size_t i = 0; i < StepsCount; ++i) {
+                            const std::size_t bit = StepsCount - 1 - i;
+                            result[i] = (words[bit / 64] >> (bit % 64)) & 1;
+                        }
+                        return result;
+                    }
+
+                    template<std::size_t StepsCount, std::size_t DigitsCount>
+                    constexpr std::array<miller_loop_digit_type, StepsCount>
+                        naf_loop_steps(const std::array<miller_loop_digit_type, DigitsCount> &naf) {
+                        std::array<miller_loop_digit_type, StepsCount> result = {};
+                        for (std::size_t i = 0; i < StepsCount; ++i) {
+                            result[i] = naf[StepsCount - 1 - i];
+                        }
+                        return result;
+                    }
+
+                    template<std::size_t StepsCount>
+                    constexpr std::size_t
+                        loop_additions_count(const std::array<miller_loop_digit_type, StepsCount> &steps) {
+                        std::size_t result = 0;
+                        for (std::size_t i = 0; i < StepsCount; ++i) {
+                            result += steps[i] != 0;
+                        }
+                        return result;
+                    }
+
+                    /**
+                     * @brief Steps of a Miller loop over a loop count fixed at compile time.
+                     *
+                     * The loop count is given as 64-bit words, least significant first. Each step after the
+                     * leading digit is a doubling step, followed by an addition step of Q for the digit 1
+                     * and of -Q for the digit -1. binary holds the digits of the binary expansion and naf
+                     * those of the non-adjacent form, most significant first, the leading digit excluded.
+                     */
+                    template<std::uint64_t... Words>
+                    struct miller_loop_schedule {
+                        typedef miller_loop_digit_type digit_type;
+
+                        constexpr static const std::array<std::uint64_t, sizeof...(Words)> words = {Words...};
+
+                        constexpr static const std::size_t bits_count = loop_count_bits(words);
+
+                        constexpr static const std::array<digit_type, bits_count - 1> binary =
+                            binary_loop_steps<bits_count - 1>(words);
+                        constexpr static const std::size_t binary_additions_count = loop_additions_count(binary);
+
+                        constexpr static const std::size_t naf_digits_count = naf_length(loop_count_naf(words));
+
+                        constexpr static const std::array<digit_type, naf_digits_count - 1> naf =
+                            naf_loop_steps<naf_digits_count - 1>(loop_count_naf(words));
+                        constexpr static const std::size_t naf_additions_count = loop_additions_count(naf);
+                    };
+
+                    template<std::uint64_t... Words>
+                    constexpr std::array<std::uint64_t, sizeof...(Words)> const
+                        miller_loop_schedule<Words...>::words;
+
+                    template<std::uint64_t... Words>
+                    constexpr std::array<miller_loop_digit_type, miller_loop_schedule<Words...>::bits_count - 1> const
+                        miller_loop_schedule<Words...>::binary;
+
+                    template<std::uint64_t... Words>
+                    constexpr std::array<miller_loop_digit_type,
+                                         miller_loop_schedule<Words...>::naf_digits_count - 1> const
+                        miller_loop_schedule<Words...>::naf;
+
+                    /// Whether the ate Miller loop runs over the NAF of the loop count, false unless
+                    /// ate_loop_is_naf is specified
+                    template<typename PairingParams, typename = void>
+                    struct ate_loop_is_naf_of : std::false_type { };
+
+                    template<typename PairingParams>
+                    struct ate_loop_is_naf_of<PairingParams, std::void_t<decltype(PairingParams::ate_loop_is_naf)>>
+                        : std::integral_constant<bool, PairingParams::ate_loop_is_naf> { };
+
+                    /// Whether the ate Miller loop ends with the lines through pi(Q) and -pi^2(Q) of the optimal
+                    /// ate pairing on BN curves, false unless ate_has_frobenius_steps is specified
+                    template<typename PairingParams, typename = void>
+                    struct ate_has_frobenius_steps_of : std::false_type { };
+
+                    template<typename PairingParams>
+                    struct ate_has_frobenius_steps_of<PairingParams,
+                                                      std::void_t<decltype(PairingParams::ate_has_frobenius_steps)>>
+                        : std::integral_constant<bool, PairingParams::ate_has_frobenius_steps> { };
+
+                    template<typename Schedule, bool IsNaf>
+                    struct ate_loop_steps {
+                        constexpr static const auto &steps = Schedule::binary;
+                        constexpr static const std::size_t additions_count = Schedule::binary_additions_count;
+                    };
+
+                    template<typename Schedule>
+                    struct ate_loop_steps<Schedule, true> {
+                        constexpr static const auto &steps = Schedule::naf;
+                        constexpr static const std::size_t additions_count = Schedule::naf_additions_count;
+                    };
+
+                    /**
+                     * @brief Shape of the ate Miller loop given by the pairing parameters.
+                     *
+                     * steps holds the digits of ate_loop_schedule the loop runs over, each of them is a
+                     * doubling step, followed by an addition step of Q or -Q for a nonzero digit. The loop
+                     * is followed by frobenius_steps_count addition steps, and coeffs_count lines are
+                     * precomputed in total.
+                     */
+                    template<typename PairingParams>
+                    struct ate_loop : ate_loop_steps<typename PairingParams::ate_loop_schedule,
+                                                     ate_loop_is_naf_of<PairingParams>::value> {
+                        typedef ate_loop_steps<typename PairingParams::ate_loop_schedule,
+                                               ate_loop_is_naf_of<PairingParams>::value>
+                            steps_type;
+
+                        constexpr static const bool has_frobenius_steps =
+                            ate_has_frobenius_steps_of<PairingParams>::value;
+                        constexpr static const std::size_t frobenius_steps_count = has_frobenius_steps ? 2 : 0;
+                        constexpr static const std::size_t coeffs_count =
+                            steps_type::steps.size() + steps_type::additions_count + frobenius_steps_count;
+                    };
+                }    // namespace detail
+            }        // namespace pairing
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_PAIRING_MILLER_LOOP_SCHEDULE_HPP
@@ -27,6 +27,7 @@
 #define CRYPTO3_ALGEBRA_PAIRING_MNT4_298_PAIRING_PARAMS_HPP
 
 #include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/pairing/detail/miller_loop_schedule.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -51,6 +52,8 @@ namespace nil {
                         constexpr static const integral_type ate_loop_count =
                             0x1EEF5546609756BEC2A33F0DC9A1B671660000_cppui149;
                         constexpr static const bool ate_is_loop_count_neg = false;
+                        /// Digits of ate_loop_count driving the Miller loops
+                        typedef miller_loop_schedule<0x0DC9A1B671660000, 0x46609756BEC2A33F, 0x1EEF55> ate_loop_schedule;
                         constexpr static const extended_integral_type final_exponent = extended_integral_type(
                             0x343C7AC3174C87A1EFE216B37AFB6D3035ACCA5A07B2394F42E0029264C0324A95E87DCB6C97234CBA7385B8D20FEA4E85074066818687634E61F58B68EA590B11CEE431BE8348DEB351384D8485E987A57004BB9A1E7A6036C7A5801F55AC8E065E41B012422619E7E69541C5980000_cppui894);
 
@@ -0,0 +1,167 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_PRECOMPUTED_COEFFS_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_PRECOMPUTED_COEFFS_HPP
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include <boost/assert.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+                namespace detail {
+                    constexpr static const std::size_t precomputed_coeffs_alignment = 64;
+
+                    /**
+                     * @brief Line coefficients of a precomputation, stored inline.
+                     *
+                     * The number of coefficients a precomputation holds is fixed by the loop count of the
+                     * curve, so they are kept in an array of that capacity rather than on the heap, aligned to
+                     * a cache line, and a precomputation is a single flat object.
+                     *
+                     * It is trivially copyable only if the coefficient type is. The field elements default
+                     * their copies, but multiprecision::number, which holds their value, has a user-provided
+                     * copy constructor, so the coefficients of the shipped curves are not and precomputations
+                     * are copied elementwise.
+                     */
+                    template<typename CoeffsType, std::size_t Capacity>
+                    struct alignas(precomputed_coeffs_alignment) precomputed_coeffs {
+                        typedef CoeffsType value_type;
+                        typedef std::size_t size_type;
+                        typedef value_type &reference;
+                        typedef const value_type &const_reference;
+                        typedef value_type *iterator;
+                        typedef const value_type *const_iterator;
+
+                        constexpr static size_type capacity() {
+                            return Capacity;
+                        }
+
+                        size_type size() const {
+                            return count;
+                        }
+
+                        bool empty() const {
+                            return count == 0;
+                        }
+
+                        void clear() {
+                            count = 0;
+                        }
+
+                        void resize(size_type new_size) {
+                            BOOST_ASSERT(new_size <= Capacity);
+                            for (size_type i = count; i < new_size; ++i) {
+                                coeffs[i] = value_type();
+                            }
+                            count = new_size;
+                        }
+
+                        void push_back(const value_type &value) {
+                            BOOST_ASSERT(count < Capacity);
+                            coeffs[count++] = value;
+                        }
+
+                        template<typename... Args>
+                        reference emplace_back(Args &&...args) {
+                            BOOST_ASSERT(count < Capacity);
+                            coeffs[count] = value_type(std::forward<Args>(args)...);
+                            return coeffs[count++];
+                        }
+
+                        reference operator[](size_type i) {
+                            BOOST_ASSERT(i < count);
+                            return coeffs[i];
+                        }
+
+                        const_reference operator[](size_type i) const {
+                            BOOST_ASSERT(i < count);
+                            return coeffs[i];
+                        }
+
+                        reference back() {
+                            BOOST_ASSERT(count > 0);
+                            return coeffs[count - 1];
+                        }
+
+                        const_reference back() const {
+                            BOOST_ASSERT(count > 0);
+                            return coeffs[count - 1];
+                        }
+
+                        value_type *data() {
+                            return coeffs.data();
+                        }
+
+                        const value_type *data() const {
+                            return coeffs.data();
+                        }
+
+                        iterator begin() {
+                            return coeffs.data();
+                        }
+
+                        const_iterator begin() const {
+                            return coeffs.data();
+                        }
+
+                        iterator end() {
+                            return coeffs.data() + count;
+                        }
+
+                        const_iterator end() const {
+                            return coeffs.data() + count;
+                        }
+
+                        bool operator==(const precomputed_coeffs &other) const {
+                            if (count != other.count) {
+                                return false;
+                            }
+                            for (size_type i = 0; i < count; ++i) {
+                                if (!(coeffs[i] == other.coeffs[i])) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        }
+
+                        bool operator!=(const precomputed_coeffs &other) const {
+                            return !(*this == other);
+                        }
+
+                        std::array<value_type, Capacity> coeffs;
+                        size_type count = 0;
+                    };
+                }    // namespace detail
+            }        // namespace pairing
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_PAIRING_PRECOMPUTED_COEFFS_HPP
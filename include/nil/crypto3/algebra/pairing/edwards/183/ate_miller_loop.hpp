@@ -55,22 +55,9 @@ namespace nil {
 
                         typename gt_type::value_type f = gt_type::value_type::one();
 
-                        bool found_one = false;
                         std::size_t idx = 0;
 
-                        const typename policy_type::integral_type &loop_count = params_type::ate_loop_count;
-
-                        for (long i = params_type::integral_type_max_bits - 1; i >= 0; --i) {
-                            const bool bit = nil::crypto3::multiprecision::bit_test(loop_count, i);
-                            if (!found_one) {
-                                /* this skips the MSB itself */
-                                found_one |= bit;
-                                continue;
-                            }
-
-                            /* code below gets executed for all bits (EXCEPT the MSB itself) of
-                               param_p (skipping leading zeros) in MSB to LSB
-                               order */
+                        for (const bool bit : params_type::ate_loop_schedule::binary) {
                             typename policy_type::Fq3_conic_coefficients cc = prec_Q[idx++];
 
                             typename gt_type::value_type g_RR_at_P = typename gt_type::value_type(
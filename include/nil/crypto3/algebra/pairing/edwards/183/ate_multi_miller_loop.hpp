@@ -0,0 +1,95 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_EDWARDS_183_ATE_MULTI_MILLER_LOOP_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_EDWARDS_183_ATE_MULTI_MILLER_LOOP_HPP
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/curves/edwards.hpp>
+#include <nil/crypto3/algebra/pairing/detail/edwards/183/params.hpp>
+#include <nil/crypto3/algebra/pairing/detail/edwards/183/types.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                template<std::size_t Version = 183>
+                class edwards_ate_multi_miller_loop;
+
+                /**
+                 * @brief Product of Miller loops over a range of (g1_precomputed_type, g2_precomputed_type)
+                 * pairs sharing the squarings of f.
+                 */
+                template<>
+                class edwards_ate_multi_miller_loop<183> {
+                    using curve_type = curves::edwards<183>;
+
+                    using params_type = detail::pairing_params<curve_type>;
+                    typedef detail::types_policy<curve_type> policy_type;
+                    using gt_type = typename curve_type::gt_type;
+
+                public:
+                    template<typename InputRange>
+                    static typename gt_type::value_type process(const InputRange &prec_pairs) {
+
+                        typename gt_type::value_type f = gt_type::value_type::one();
+
+                        std::size_t idx = 0;
+
+                        for (const bool bit : params_type::ate_loop_schedule::binary) {
+                            f = f.squared();
+                            for (const auto &prec : prec_pairs) {
+                                const policy_type::ate_g1_precomputed_type &prec_P = prec.first;
+                                const typename policy_type::Fq3_conic_coefficients &cc = prec.second[idx];
+
+                                typename gt_type::value_type g_RR_at_P = typename gt_type::value_type(
+                                    prec_P.P_XY * cc.c_XY + prec_P.P_XZ * cc.c_XZ, prec_P.P_ZZplusYZ * cc.c_ZZ);
+                                f = f * g_RR_at_P;
+                            }
+                            ++idx;
+
+                            if (bit) {
+                                for (const auto &prec : prec_pairs) {
+                                    const policy_type::ate_g1_precomputed_type &prec_P = prec.first;
+                                    const typename policy_type::Fq3_conic_coefficients &cc = prec.second[idx];
+
+                                    typename gt_type::value_type g_RQ_at_P = typename gt_type::value_type(
+                                        prec_P.P_ZZplusYZ * cc.c_ZZ, prec_P.P_XY * cc.c_XY + prec_P.P_XZ * cc.c_XZ);
+                                    f = f * g_RQ_at_P;
+                                }
+                                ++idx;
+                            }
+                        }
+
+                        return f;
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_EDWARDS_183_ATE_MULTI_MILLER_LOOP_HPP
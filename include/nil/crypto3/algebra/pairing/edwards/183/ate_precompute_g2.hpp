@@ -174,17 +174,7 @@ namespace nil {
 
                         extended_g2_projective R = Q_ext;
 
-                        const typename policy_type::integral_type &loop_count = params_type::ate_loop_count;
-
-                        bool found_one = false;
-                        for (long i = params_type::integral_type_max_bits - 1; i >= 0; --i) {
-                            const bool bit = nil::crypto3::multiprecision::bit_test(loop_count, i);
-                            if (!found_one) {
-                                /* this skips the MSB itself */
-                                found_one |= bit;
-                                continue;
-                            }
-
+                        for (const bool bit : params_type::ate_loop_schedule::binary) {
                             typename policy_type::Fq3_conic_coefficients cc;
                             doubling_step_for_flipped_miller_loop(R, cc);
                             result.push_back(cc);
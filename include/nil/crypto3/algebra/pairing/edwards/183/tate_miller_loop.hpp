@@ -55,20 +55,8 @@ namespace nil {
 
                         typename gt_type::value_type f = gt_type::value_type::one();
 
-                        bool found_one = false;
                         std::size_t idx = 0;
-                        for (long i = policy_type::scalar_field_bits - 1; i >= 0; --i) {
-                            const bool bit =
-                                nil::crypto3::multiprecision::bit_test(policy_type::scalar_field_modulus, i);
-                            if (!found_one) {
-                                /* this skips the MSB itself */
-                                found_one |= bit;
-                                continue;
-                            }
-
-                            /* code below gets executed for all bits (EXCEPT the MSB itself) of
-                               policy_type::scalar_field_modulus (skipping leading zeros) in MSB to LSB
-                               order */
+                        for (const bool bit : params_type::tate_loop_schedule::binary) {
                             typename policy_type::Fq_conic_coefficients cc = prec_P[idx++];
                             typename gt_type::value_type g_RR_at_Q = typename gt_type::value_type(
                                 Fq3(cc.c_XZ, Fq(0l), Fq(0l)) + cc.c_XY * prec_Q.y0, cc.c_ZZ * prec_Q.eta);
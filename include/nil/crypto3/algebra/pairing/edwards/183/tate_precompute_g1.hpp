@@ -159,19 +159,7 @@ namespace nil {
 
                         extended_g1_projective R = P_ext;
 
-                        bool found_one = false;
-                        for (long i = params_type::scalar_field_bits; i >= 0; --i) {
-                            const bool bit =
-                                nil::crypto3::multiprecision::bit_test(params_type::scalar_field_modulus, i);
-                            if (!found_one) {
-                                /* this skips the MSB itself */
-                                found_one |= bit;
-                                continue;
-                            }
-
-                            /* code below gets executed for all bits (EXCEPT the MSB itself) of
-                               params_type::scalar_field_modulus (skipping leading zeros) in MSB to LSB
-                               order */
+                        for (const bool bit : params_type::tate_loop_schedule::binary) {
                             policy_type::Fq_conic_coefficients cc;
 
                             doubling_step_for_miller_loop(R, cc);
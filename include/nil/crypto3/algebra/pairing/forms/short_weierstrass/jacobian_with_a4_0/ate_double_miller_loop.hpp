@@ -30,6 +30,7 @@
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
 #include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/lines.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -42,6 +43,8 @@ namespace nil {
 
                     using params_type = detail::pairing_params<curve_type>;
                     typedef detail::short_weierstrass_jacobian_with_a4_0_types_policy<curve_type> policy_type;
+                    typedef detail::short_weierstrass_jacobian_with_a4_0_ate_lines<curve_type> lines_type;
+                    typedef detail::ate_loop<params_type> loop_type;
 
                     using gt_type = typename curve_type::gt_type;
 
@@ -54,39 +57,18 @@ namespace nil {
 
                         typename gt_type::value_type f = gt_type::value_type::one();
 
-                        bool found_one = false;
                         std::size_t idx = 0;
 
-                        const typename policy_type::integral_type &loop_count = params_type::ate_loop_count;
-
-                        for (long i = params_type::integral_type_max_bits; i >= 0; --i) {
-                            const bool bit = nil::crypto3::multiprecision::bit_test(loop_count, i);
-                            if (!found_one) {
-                                /* this skips the MSB itself */
-                                found_one |= bit;
-                                continue;
-                            }
-
-                            /* code below gets executed for all bits (EXCEPT the MSB itself) of
-                               param_p (skipping leading zeros) in MSB to LSB
-                               order */
-
-                            typename policy_type::ate_ell_coeffs c1 = prec_Q1.coeffs[idx];
-                            typename policy_type::ate_ell_coeffs c2 = prec_Q2.coeffs[idx];
-                            ++idx;
-
+                        for (const detail::miller_loop_digit_type digit : loop_type::steps) {
                             f = f.squared();
 
-                            f = f.mul_by_045(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
-                            f = f.mul_by_045(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+                            f = lines_type::mul_by_lines(f, prec_P1, prec_Q1.coeffs[idx], prec_P2, prec_Q2.coeffs[idx]);
+                            ++idx;
 
-                            if (bit) {
-                                typename policy_type::ate_ell_coeffs c1 = prec_Q1.coeffs[idx];
-                                typename policy_type::ate_ell_coeffs c2 = prec_Q2.coeffs[idx];
+                            if (digit != 0) {
+                                f = lines_type::mul_by_lines(f, prec_P1, prec_Q1.coeffs[idx], prec_P2,
+                                                             prec_Q2.coeffs[idx]);
                                 ++idx;
-
-                                f = f.mul_by_045(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
-                                f = f.mul_by_045(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
                             }
                         }
 
@@ -94,6 +76,10 @@ namespace nil {
                             f = f.inversed();
                         }
 
+                        for (std::size_t i = 0; i < loop_type::frobenius_steps_count; ++i, ++idx) {
+                            f = lines_type::mul_by_lines(f, prec_P1, prec_Q1.coeffs[idx], prec_P2, prec_Q2.coeffs[idx]);
+                        }
+
                         return f;
                     }
                 };
@@ -30,6 +30,7 @@
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
 #include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/lines.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -42,6 +43,8 @@ namespace nil {
 
                     using params_type = detail::pairing_params<curve_type>;
                     typedef detail::short_weierstrass_jacobian_with_a4_0_types_policy<curve_type> policy_type;
+                    typedef detail::short_weierstrass_jacobian_with_a4_0_ate_lines<curve_type> lines_type;
+                    typedef detail::ate_loop<params_type> loop_type;
 
                     using gt_type = typename curve_type::gt_type;
 
@@ -52,32 +55,17 @@ namespace nil {
 
                         typename gt_type::value_type f = gt_type::value_type::one();
 
-                        bool found_one = false;
                         std::size_t idx = 0;
 
-                        const typename policy_type::integral_type &loop_count = params_type::ate_loop_count;
-
-                        typename policy_type::ate_ell_coeffs c;
-
-                        for (long i = params_type::integral_type_max_bits; i >= 0; --i) {
-                            const bool bit = multiprecision::bit_test(loop_count, i);
-                            if (!found_one) {
-                                /* this skips the MSB itself */
-                                found_one |= bit;
-                                continue;
-                            }
-
-                            /* code below gets executed for all bits (EXCEPT the MSB itself) of
-                               param_p (skipping leading zeros) in MSB to LSB
-                               order */
-
-                            c = prec_Q.coeffs[idx++];
+                        for (const detail::miller_loop_digit_type digit : loop_type::steps) {
                             f = f.squared();
-                            f = f.mul_by_045(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
 
-                            if (bit) {
-                                c = prec_Q.coeffs[idx++];
-                                f = f.mul_by_045(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
+                            if (digit != 0) {
+                                f = lines_type::mul_by_lines(f, prec_P, prec_Q.coeffs[idx], prec_P,
+                                                             prec_Q.coeffs[idx + 1]);
+                                idx += 2;
+                            } else {
+                                f = lines_type::mul_by_line(f, prec_P, prec_Q.coeffs[idx++]);
                             }
                         }
 
@@ -85,6 +73,10 @@ namespace nil {
                             f = f.inversed();
                         }
 
+                        if constexpr (loop_type::has_frobenius_steps) {
+                            f = lines_type::mul_by_lines(f, prec_P, prec_Q.coeffs[idx], prec_P, prec_Q.coeffs[idx + 1]);
+                        }
+
                         return f;
                     }
                 };
@@ -0,0 +1,110 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_MULTI_MILLER_LOOP_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_MULTI_MILLER_LOOP_HPP
+
+#include <iterator>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/lines.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /**
+                 * @brief Product of Miller loops over a range of (g1_precomputed_type, g2_precomputed_type)
+                 * pairs sharing the Fp12 squarings, so that one final exponentiation gives the product of
+                 * the pairings.
+                 */
+                template<typename CurveType>
+                class short_weierstrass_jacobian_with_a4_0_ate_multi_miller_loop {
+                    using curve_type = CurveType;
+
+                    using params_type = detail::pairing_params<curve_type>;
+                    typedef detail::short_weierstrass_jacobian_with_a4_0_types_policy<curve_type> policy_type;
+                    typedef detail::short_weierstrass_jacobian_with_a4_0_ate_lines<curve_type> lines_type;
+                    typedef detail::ate_loop<params_type> loop_type;
+
+                    using gt_type = typename curve_type::gt_type;
+
+                    template<typename InputRange>
+                    static void add_lines(typename gt_type::value_type &f, const InputRange &prec_pairs,
+                                          std::size_t idx) {
+                        auto it = std::begin(prec_pairs);
+                        const auto end = std::end(prec_pairs);
+
+                        // lines of consecutive pairs are multiplied together before being applied to f
+                        while (it != end) {
+                            const auto &prec1 = *it;
+                            if (++it == end) {
+                                f = lines_type::mul_by_line(f, prec1.first, prec1.second.coeffs[idx]);
+                                break;
+                            }
+                            const auto &prec2 = *it;
+                            ++it;
+
+                            f = lines_type::mul_by_lines(f, prec1.first, prec1.second.coeffs[idx], prec2.first,
+                                                         prec2.second.coeffs[idx]);
+                        }
+                    }
+
+                public:
+                    template<typename InputRange>
+                    static typename gt_type::value_type process(const InputRange &prec_pairs) {
+
+                        typename gt_type::value_type f = gt_type::value_type::one();
+
+                        std::size_t idx = 0;
+
+                        for (const detail::miller_loop_digit_type digit : loop_type::steps) {
+                            f = f.squared();
+                            add_lines(f, prec_pairs, idx++);
+
+                            if (digit != 0) {
+                                add_lines(f, prec_pairs, idx++);
+                            }
+                        }
+
+                        if (params_type::ate_is_loop_count_neg) {
+                            f = f.inversed();
+                        }
+
+                        for (std::size_t i = 0; i < loop_type::frobenius_steps_count; ++i) {
+                            add_lines(f, prec_pairs, idx++);
+                        }
+
+                        return f;
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_MULTI_MILLER_LOOP_HPP
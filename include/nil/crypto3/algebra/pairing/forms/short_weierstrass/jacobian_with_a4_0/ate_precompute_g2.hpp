@@ -29,6 +29,8 @@
 #include <nil/crypto3/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
+#include <nil/crypto3/algebra/pairing/detail/miller_loop_schedule.hpp>
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/twist_type.hpp>
 #include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
 
 namespace nil {
@@ -42,6 +44,7 @@ namespace nil {
 
                     using params_type = detail::pairing_params<curve_type>;
                     typedef detail::short_weierstrass_jacobian_with_a4_0_types_policy<curve_type> policy_type;
+                    typedef detail::ate_loop<params_type> loop_type;
 
                     using base_field_type = typename curve_type::base_field_type;
                     using g2_type = typename curve_type::template g2_type<>;
@@ -49,6 +52,8 @@ namespace nil {
 
                     using g2_field_type_value = typename g2_type::field_type::value_type;
 
+                    constexpr static const detail::twist_type twist_kind = detail::twist_type_of<params_type>::value;
+
                     static void doubling_step_for_miller_loop(const typename base_field_type::value_type &two_inv,
                                                               typename g2_type::value_type &current,
                                                               typename policy_type::ate_ell_coeffs &c) {
@@ -71,9 +76,14 @@ namespace nil {
                         current.X = A * (B - F);                         // X3 = A * (B-F)
                         current.Y = G.squared() - (0x03 * E_squared);    // Y3 = G^2 - 3*E^2
                         current.Z = B * H;                               // Z3 = B * H
-                        c.ell_0 = I;                                     // ell_0 = xi * I
-                        c.ell_VW = -params_type::twist * H;              // ell_VW = - H (later: * yP)
-                        c.ell_VV = 0x03 * J;                             // ell_VV = 3*J (later: * xP)
+                        if constexpr (twist_kind == detail::twist_type::d_type) {
+                            c.ell_0 = params_type::twist * I;    // ell_0 = xi * I
+                            c.ell_VW = -H;                       // ell_VW = - H (later: * yP)
+                        } else {
+                            c.ell_0 = I;                           // ell_0 = I
+                            c.ell_VW = -params_type::twist * H;    // ell_VW = - xi * H (later: * yP)
+                        }
+                        c.ell_VV = 0x03 * J;    // ell_VV = 3*J (later: * xP)
                     }
 
                     static void mixed_addition_step_for_miller_loop(const typename g2_affine_type::value_type base,
@@ -94,9 +104,14 @@ namespace nil {
                         current.X = D * J;                     // X3 = D*J
                         current.Y = E * (I - J) - (H * Y1);    // Y3 = E*(I-J)-(H*Y1)
                         current.Z = Z1 * H;                    // Z3 = Z1*H
-                        c.ell_0 = E * x2 - D * y2;             // ell_0 = xi * (E * X2 - D * Y2)
-                        c.ell_VV = -E;                         // ell_VV = - E (later: * xP)
-                        c.ell_VW = params_type::twist * D;     // ell_VW = D (later: * yP    )
+                        if constexpr (twist_kind == detail::twist_type::d_type) {
+                            c.ell_0 = params_type::twist * (E * x2 - D * y2);    // ell_0 = xi * (E * X2 - D * Y2)
+                            c.ell_VW = D;                                        // ell_VW = D (later: * yP)
+                        } else {
+                            c.ell_0 = E * x2 - D * y2;            // ell_0 = E * X2 - D * Y2
+                            c.ell_VW = params_type::twist * D;    // ell_VW = xi * D (later: * yP)
+                        }
+                        c.ell_VV = -E;    // ell_VV = - E (later: * xP)
                     }
 
                 public:
@@ -118,31 +133,49 @@ namespace nil {
                         R.Y = Qcopy.Y;
                         R.Z = g2_type::field_type::value_type::one();
 
-                        const typename policy_type::integral_type &loop_count = params_type::ate_loop_count;
+                        typename g2_affine_type::value_type minus_Q = Qcopy;
+                        minus_Q.Y = -minus_Q.Y;
 
-                        bool found_one = false;
                         typename policy_type::ate_ell_coeffs c;
 
-                        for (long i = params_type::integral_type_max_bits; i >= 0; --i) {
-                            const bool bit = multiprecision::bit_test(loop_count, i);
-                            if (!found_one) {
-                                /* this skips the MSB itself */
-                                found_one |= bit;
-                                continue;
-                            }
-
+                        for (const detail::miller_loop_digit_type digit : loop_type::steps) {
                             doubling_step_for_miller_loop(two_inv, R, c);
                             result.coeffs.push_back(c);
 
-                            if (bit) {
-                                mixed_addition_step_for_miller_loop(Qcopy, R, c);
+                            if (digit != 0) {
+                                mixed_addition_step_for_miller_loop(digit > 0 ? Qcopy : minus_Q, R, c);
                                 result.coeffs.push_back(c);
                             }
                         }
 
+                        if constexpr (loop_type::has_frobenius_steps) {
+                            // R = [loop_count]Q, followed by R + pi(Q) and R - pi^2(Q)
+                            typename g2_affine_type::value_type Q1 = Qcopy;
+                            Q1.X = params_type::twist_frobenius_x * Qcopy.X.Frobenius_map(1);
+                            Q1.Y = params_type::twist_frobenius_y * Qcopy.Y.Frobenius_map(1);
+
+                            typename g2_affine_type::value_type minus_Q2 = Q1;
+                            minus_Q2.X = params_type::twist_frobenius_x * Q1.X.Frobenius_map(1);
+                            minus_Q2.Y = -(params_type::twist_frobenius_y * Q1.Y.Frobenius_map(1));
+
+                            if (params_type::ate_is_loop_count_neg) {
+                                R.Y = -R.Y;
+                            }
+
+                            mixed_addition_step_for_miller_loop(Q1, R, c);
+                            result.coeffs.push_back(c);
+
+                            mixed_addition_step_for_miller_loop(minus_Q2, R, c);
+                            result.coeffs.push_back(c);
+                        }
+
                         return result;
                     }
                 };
+
+                template<typename CurveType>
+                constexpr detail::twist_type const
+                    short_weierstrass_jacobian_with_a4_0_ate_precompute_g2<CurveType>::twist_kind;
             }    // namespace pairing
         }        // namespace algebra
     }            // namespace crypto3
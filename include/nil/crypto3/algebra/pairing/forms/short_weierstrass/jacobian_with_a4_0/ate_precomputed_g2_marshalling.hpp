@@ -0,0 +1,171 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_PRECOMPUTED_G2_MARSHALLING_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_PRECOMPUTED_G2_MARSHALLING_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /**
+                 * @brief Byte format of ate_g2_precomputed_type.
+                 *
+                 * QX, QY and then ell_0, ell_VW, ell_VV of every ate_ell_coeffs, each Fp2 element as c0 || c1
+                 * and each Fp element as a fixed size little-endian integer. The number of coefficients depends
+                 * on the ate loop count only, so all the precomputations of a curve have the same size.
+                 */
+                template<typename CurveType>
+                class short_weierstrass_jacobian_with_a4_0_ate_precomputed_g2_marshalling {
+                    using curve_type = CurveType;
+
+                    using params_type = detail::pairing_params<curve_type>;
+                    typedef detail::short_weierstrass_jacobian_with_a4_0_types_policy<curve_type> policy_type;
+
+                    using base_field_type = typename curve_type::base_field_type;
+                    using g2_field_value_type = typename policy_type::g2_field_value_type;
+
+                public:
+                    using g2_precomputed_type = typename policy_type::ate_g2_precomputed_type;
+
+                    typedef std::uint8_t chunk_type;
+                    constexpr static const std::size_t chunk_size = 8;
+
+                    constexpr static const std::size_t fp_octets_num =
+                        base_field_type::modulus_bits / chunk_size +
+                        (base_field_type::modulus_bits % chunk_size ? 1 : 0);
+                    constexpr static const std::size_t fp2_octets_num = 2 * fp_octets_num;
+
+                    /// Number of coefficients given by precompute_g2, one per doubling and one per addition step
+                    constexpr static std::size_t coeffs_count() {
+                        return policy_type::ate_coeffs_count;
+                    }
+
+                    constexpr static std::size_t octets_num() {
+                        return (2 + 3 * coeffs_count()) * fp2_octets_num;
+                    }
+
+                    /// Writes octets_num() bytes of prec_Q, returns the iterator past the last written byte
+                    template<typename OutputIterator>
+                    static OutputIterator to_bytes(const g2_precomputed_type &prec_Q, OutputIterator out) {
+                        BOOST_ASSERT(prec_Q.coeffs.size() == coeffs_count());
+
+                        out = fp2_to_bytes(prec_Q.QX, out);
+                        out = fp2_to_bytes(prec_Q.QY, out);
+                        for (const typename policy_type::ate_ell_coeffs &c : prec_Q.coeffs) {
+                            out = fp2_to_bytes(c.ell_0, out);
+                            out = fp2_to_bytes(c.ell_VW, out);
+                            out = fp2_to_bytes(c.ell_VV, out);
+                        }
+
+                        return out;
+                    }
+
+                    /**
+                     * @brief Reads a precomputation written by to_bytes.
+                     * The flag is false if the size of the range is wrong or some integer is not reduced.
+                     */
+                    template<typename InputIterator>
+                    static std::pair<bool, g2_precomputed_type> from_bytes(InputIterator first, InputIterator last) {
+                        g2_precomputed_type result;
+
+                        if (static_cast<std::size_t>(std::distance(first, last)) != octets_num()) {
+                            return std::make_pair(false, result);
+                        }
+
+                        bool valid = fp2_from_bytes(first, result.QX);
+                        valid = fp2_from_bytes(first, result.QY) && valid;
+
+                        result.coeffs.resize(coeffs_count());
+                        for (typename policy_type::ate_ell_coeffs &c : result.coeffs) {
+                            valid = fp2_from_bytes(first, c.ell_0) && valid;
+                            valid = fp2_from_bytes(first, c.ell_VW) && valid;
+                            valid = fp2_from_bytes(first, c.ell_VV) && valid;
+                        }
+
+                        return std::make_pair(valid, result);
+                    }
+
+                private:
+                    template<typename OutputIterator>
+                    static OutputIterator fp2_to_bytes(const g2_field_value_type &element, OutputIterator out) {
+                        for (const auto &coordinate : element.data) {
+                            std::array<chunk_type, fp_octets_num> octets;
+                            octets.fill(0);
+                            multiprecision::export_bits(
+                                coordinate.data.template convert_to<typename base_field_type::integral_type>(),
+                                octets.begin(), chunk_size, false);
+                            out = std::copy(octets.begin(), octets.end(), out);
+                        }
+
+                        return out;
+                    }
+
+                    template<typename InputIterator>
+                    static bool fp2_from_bytes(InputIterator &first, g2_field_value_type &element) {
+                        bool valid = true;
+                        for (auto &coordinate : element.data) {
+                            std::array<chunk_type, fp_octets_num> octets;
+                            for (chunk_type &octet : octets) {
+                                octet = *first++;
+                            }
+
+                            typename base_field_type::integral_type value;
+                            multiprecision::import_bits(value, octets.begin(), octets.end(), chunk_size, false);
+                            valid = valid && value < base_field_type::modulus;
+                            coordinate = typename base_field_type::value_type(value);
+                        }
+
+                        return valid;
+                    }
+                };
+
+                template<typename CurveType>
+                constexpr std::size_t const
+                    short_weierstrass_jacobian_with_a4_0_ate_precomputed_g2_marshalling<CurveType>::chunk_size;
+                template<typename CurveType>
+                constexpr std::size_t const
+                    short_weierstrass_jacobian_with_a4_0_ate_precomputed_g2_marshalling<CurveType>::fp_octets_num;
+                template<typename CurveType>
+                constexpr std::size_t const
+                    short_weierstrass_jacobian_with_a4_0_ate_precomputed_g2_marshalling<CurveType>::fp2_octets_num;
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_PRECOMPUTED_G2_MARSHALLING_HPP
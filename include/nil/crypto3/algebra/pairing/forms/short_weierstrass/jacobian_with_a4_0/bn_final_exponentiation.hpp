@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_BN_FINAL_EXPONENTIATION_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_BN_FINAL_EXPONENTIATION_HPP
+
+#include <vector>
+
+#include <nil/crypto3/multiprecision/wnaf.hpp>
+
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /**
+                 * @brief Final exponentiation of BN curves, p = 36z^4 + 36z^3 + 24z^2 + 6z + 1.
+                 *
+                 * The hard part follows L. Fuentes-Castaneda, E. Knapp and F. Rodriguez-Henriquez,
+                 * "Faster hashing to G2", and raises to a multiple of (p^4 - p^2 + 1)/r coprime to r,
+                 * which costs three exponentiations by z.
+                 */
+                template<typename CurveType>
+                class short_weierstrass_jacobian_with_a4_0_bn_final_exponentiation {
+                    using curve_type = CurveType;
+
+                    using params_type = detail::pairing_params<curve_type>;
+
+                    using gt_type = typename curve_type::gt_type;
+                    using gt_value_type = typename gt_type::value_type;
+
+                    static gt_value_type final_exponentiation_first_chunk(const gt_value_type &elt) {
+
+                        // elt^((p^6-1)*(p^2+1)) = (conj(elt) * elt^(-1))^(p^2+1)
+                        const gt_value_type A = elt.unitary_inversed();
+                        const gt_value_type B = elt.inversed();
+                        const gt_value_type C = A * B;
+                        const gt_value_type D = C.Frobenius_map(2);
+                        const gt_value_type result = D * C;
+
+                        return result;
+                    }
+
+                    /// Signed binary digits of -z
+                    static std::vector<long> final_exponent_neg_z_naf() {
+                        std::vector<long> naf = multiprecision::find_wnaf(1, params_type::final_exponent_z);
+                        if (!params_type::final_exponent_is_z_neg) {
+                            for (long &digit : naf) {
+                                digit = -digit;
+                            }
+                        }
+
+                        return naf;
+                    }
+
+                    static gt_value_type exp_by_neg_z(const gt_value_type &elt) {
+                        static const std::vector<long> neg_z_naf = final_exponent_neg_z_naf();
+
+                        return elt.cyclotomic_exp_naf(neg_z_naf);
+                    }
+
+                    static gt_value_type final_exponentiation_last_chunk(const gt_value_type &elt) {
+
+                        /*
+                          result = elt^(p^3 * (12z^3 + 6z^2 + 4z - 1) + p^2 * (12z^3 + 6z^2 + 6z) +
+                                        p * (12z^3 + 6z^2 + 4z) + (12z^3 + 12z^2 + 6z + 1))
+                                 = elt^(2z * (6z^2 + 3z + 1) * (p^4 - p^2 + 1)/r)
+                        */
+                        const gt_value_type A = exp_by_neg_z(elt);       // elt^(-z)
+                        const gt_value_type B = A.cyclotomic_squared();    // elt^(-2z)
+                        const gt_value_type C = B.cyclotomic_squared();    // elt^(-4z)
+                        const gt_value_type D = C * B;                     // elt^(-6z)
+                        const gt_value_type E = exp_by_neg_z(D);           // elt^(6z^2)
+                        const gt_value_type F = E.cyclotomic_squared();    // elt^(12z^2)
+                        const gt_value_type G = exp_by_neg_z(F);           // elt^(-12z^3)
+                        const gt_value_type H = D.unitary_inversed();      // elt^(6z)
+                        const gt_value_type I = G.unitary_inversed();      // elt^(12z^3)
+                        const gt_value_type J = I * E;                     // elt^(12z^3 + 6z^2)
+                        const gt_value_type K = J * H;                     // elt^(12z^3 + 6z^2 + 6z)
+                        const gt_value_type L = K * B;                     // elt^(12z^3 + 6z^2 + 4z)
+                        const gt_value_type M = K * E;                     // elt^(12z^3 + 12z^2 + 6z)
+                        const gt_value_type N = M * elt;                   // elt^(12z^3 + 12z^2 + 6z + 1)
+                        const gt_value_type O = L.Frobenius_map(1);        // elt^(p * (12z^3 + 6z^2 + 4z))
+                        const gt_value_type P = O * N;
+                        const gt_value_type Q = K.Frobenius_map(2);    // elt^(p^2 * (12z^3 + 6z^2 + 6z))
+                        const gt_value_type R = Q * P;
+                        const gt_value_type S = elt.unitary_inversed();    // elt^(-1)
+                        const gt_value_type T = S * L;                     // elt^(12z^3 + 6z^2 + 4z - 1)
+                        const gt_value_type U = T.Frobenius_map(3);        // elt^(p^3 * (12z^3 + 6z^2 + 4z - 1))
+                        const gt_value_type V = U * R;
+
+                        return V;
+                    }
+
+                public:
+                    static gt_value_type process(const gt_value_type &elt) {
+                        return final_exponentiation_last_chunk(final_exponentiation_first_chunk(elt));
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_BN_FINAL_EXPONENTIATION_HPP
@@ -26,6 +26,10 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_FINAL_EXPONENTIATION_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_FINAL_EXPONENTIATION_HPP
 
+#include <vector>
+
+#include <nil/crypto3/multiprecision/wnaf.hpp>
+
 #include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
 
 namespace nil {
@@ -67,14 +71,22 @@ namespace nil {
                         return result;
                     }
 
-                    static typename gt_type::value_type exp_by_z(const typename gt_type::value_type &elt) {
-
-                        typename gt_type::value_type result = elt.cyclotomic_exp(params_type::final_exponent_z);
+                    /// Signed binary digits of z, including its sign
+                    static std::vector<long> final_exponent_z_naf() {
+                        std::vector<long> naf = multiprecision::find_wnaf(1, params_type::final_exponent_z);
                         if (params_type::final_exponent_is_z_neg) {
-                            result = result.unitary_inversed();
+                            for (long &digit : naf) {
+                                digit = -digit;
+                            }
                         }
 
-                        return result;
+                        return naf;
+                    }
+
+                    static typename gt_type::value_type exp_by_z(const typename gt_type::value_type &elt) {
+                        static const std::vector<long> z_naf = final_exponent_z_naf();
+
+                        return elt.cyclotomic_exp_naf(z_naf);
                     }
 
                     static typename gt_type::value_type
@@ -62,17 +62,8 @@ namespace nil {
 
                         g2_field_type_value RX = Qcopy.X;
                         g2_field_type_value RY = Qcopy.Y;
-                        bool found_nonzero = false;
-
-                        std::vector<long> NAF = multiprecision::find_wnaf(1, policy_type::ate_loop_count);
-
-                        for (long i = NAF.size() - 1; i >= 0; --i) {
-                            if (!found_nonzero) {
-                                /* this skips the MSB itself */
-                                found_nonzero |= (NAF[i] != 0);
-                                continue;
-                            }
 
+                        for (const detail::miller_loop_digit_type digit : params_type::ate_loop_schedule::naf) {
                             typename policy_type::affine_ate_coeffs c;
                             c.old_RX = RX;
                             c.old_RY = RY;
@@ -87,11 +78,11 @@ namespace nil {
                             RX = c.gamma.squared() - (c.old_RX + c.old_RX);
                             RY = c.gamma * (c.old_RX - RX) - c.old_RY;
 
-                            if (NAF[i] != 0) {
+                            if (digit != 0) {
                                 typename policy_type::affine_ate_coeffs c;
                                 c.old_RX = RX;
                                 c.old_RY = RY;
-                                if (NAF[i] > 0) {
+                                if (digit > 0) {
                                     c.gamma = (c.old_RY - result.QY) * (c.old_RX - result.QX).inversed();
                                 } else {
                                     c.gamma = (c.old_RY + result.QY) * (c.old_RX - result.QX).inversed();
@@ -132,16 +132,8 @@ namespace nil {
                         R.Y = Qcopy.Y;
                         R.Z = g2_field_type_value::one();
                         R.T = g2_field_type_value::one();
-                        bool found_one = false;
-
-                        for (long i = params_type::integral_type_max_bits - 1; i >= 0; --i) {
-                            const bool bit = multiprecision::bit_test(params_type::ate_loop_count, i);
-                            if (!found_one) {
-                                /* this skips the MSB itself */
-                                found_one |= bit;
-                                continue;
-                            }
 
+                        for (const bool bit : params_type::ate_loop_schedule::binary) {
                             typename policy_type::ate_dbl_coeffs dc;
                             doubling_step_for_flipped_miller_loop(R, dc);
                             result.dbl_coeffs.push_back(dc);
@@ -45,6 +45,7 @@ namespace nil {
                 class mnt4_affine_ate_miller_loop<298> {
                     using curve_type = curves::mnt4<298>;
 
+                    using params_type = detail::pairing_params<curve_type>;
                     typedef detail::short_weierstrass_projective_types_policy<curve_type> policy_type;
                     using gt_type = typename curve_type::gt_type;
 
@@ -55,31 +56,19 @@ namespace nil {
 
                         typename gt_type::value_type f = gt_type::value_type::one();
 
-                        bool found_nonzero = false;
                         std::size_t idx = 0;
 
-                        std::vector<long> NAF = multiprecision::find_wnaf(1, policy_type::ate_loop_count);
-
-                        for (long i = NAF.size() - 1; i >= 0; --i) {
-                            if (!found_nonzero) {
-                                /* this skips the MSB itself */
-                                found_nonzero |= (NAF[i] != 0);
-                                continue;
-                            }
-
-                            /* code below gets executed for all bits (EXCEPT the MSB itself) of
-                               param_p (skipping leading zeros) in MSB to LSB
-                               order */
+                        for (const detail::miller_loop_digit_type digit : params_type::ate_loop_schedule::naf) {
                             typename policy_type::affine_ate_coeffs c = prec_Q.coeffs[idx++];
 
                             typename gt_type::value_type g_RR_at_P = typename gt_type::value_type(
                                 prec_P.PY_twist_squared, -prec_P.PX * c.gamma_twist + c.gamma_X - c.old_RY);
                             f = f.squared().mul_by_023(g_RR_at_P);
 
-                            if (NAF[i] != 0) {
+                            if (digit != 0) {
                                 typename policy_type::affine_ate_coeffs c = prec_Q.coeffs[idx++];
                                 typename gt_type::value_type g_RQ_at_P;
-                                if (NAF[i] > 0) {
+                                if (digit > 0) {
                                     g_RQ_at_P = typename gt_type::value_type(
                                         prec_P.PY_twist_squared, -prec_P.PX * c.gamma_twist + c.gamma_X - prec_Q.QY);
                                 } else {
@@ -65,22 +65,10 @@ namespace nil {
 
                         typename gt_type::value_type f = gt_type::value_type::one();
 
-                        bool found_one = false;
                         std::size_t dbl_idx = 0;
                         std::size_t add_idx = 0;
 
-                        for (long i = params_type::integral_type_max_bits - 1; i >= 0; --i) {
-                            const bool bit = multiprecision::bit_test(params_type::ate_loop_count, i);
-
-                            if (!found_one) {
-                                /* this skips the MSB itself */
-                                found_one |= bit;
-                                continue;
-                            }
-
-                            /* code below gets executed for all bits (EXCEPT the MSB itself) of
-                               param_p (skipping leading zeros) in MSB to LSB
-                               order */
+                        for (const bool bit : params_type::ate_loop_schedule::binary) {
                             typename policy_type::ate_dbl_coeffs dc = prec_Q.dbl_coeffs[dbl_idx++];
 
                             typename gt_type::value_type g_RR_at_P = typename gt_type::value_type(
@@ -0,0 +1,285 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_PRECOMPUTED_G2_CACHE_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_PRECOMPUTED_G2_CACHE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+#include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /**
+                 * @brief Read-only store of G2 precomputations laid out in a contiguous byte range,
+                 * e.g. a memory-mapped file, so that nothing has to be parsed before the first lookup.
+                 *
+                 * Layout, integers are 64-bit little-endian:
+                 *  - magic "c3g2prec", key size, record size, records count;
+                 *  - records sorted by key, each is the compressed G2 point followed by its precomputation
+                 *    in PairingPolicy::precomputed_g2_marshalling format.
+                 *
+                 * The store is trusted: the line coefficients of a record are not verified, so a store
+                 * with corrupted coefficients gives wrong pairings. It has to come from build() through
+                 * a channel that preserves its integrity.
+                 */
+                template<typename CurveType, typename PairingPolicy = pairing_policy<CurveType>>
+                class precomputed_g2_store_view {
+                    typedef marshalling::curve_element_serializer<CurveType> serializer_type;
+                    typedef typename PairingPolicy::precomputed_g2_marshalling marshalling_type;
+
+                    constexpr static const std::array<std::uint8_t, 8> magic = {'c', '3', 'g', '2',
+                                                                                'p', 'r', 'e', 'c'};
+                    constexpr static const std::size_t header_octets_num = 32;
+
+                    const std::uint8_t *records;
+                    std::size_t records_count;
+
+                    static void write_uint64(std::uint64_t value, std::uint8_t *out) {
+                        for (std::size_t i = 0; i < 8; ++i) {
+                            out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+                        }
+                    }
+
+                    static std::uint64_t read_uint64(const std::uint8_t *in) {
+                        std::uint64_t value = 0;
+                        for (std::size_t i = 0; i < 8; ++i) {
+                            value |= static_cast<std::uint64_t>(in[i]) << (8 * i);
+                        }
+                        return value;
+                    }
+
+                public:
+                    typedef typename CurveType::template g2_type<>::value_type g2_value_type;
+                    typedef typename g2_value_type::field_type::value_type g2_field_value_type;
+                    typedef typename PairingPolicy::g2_precomputed_type g2_precomputed_type;
+                    typedef typename serializer_type::compressed_g2_octets key_type;
+
+                    static std::size_t record_octets_num() {
+                        return std::tuple_size<key_type>::value + marshalling_type::octets_num();
+                    }
+
+                    /// Size of the store of records_count precomputations
+                    static std::size_t octets_num(std::size_t records_count) {
+                        return header_octets_num + records_count * record_octets_num();
+                    }
+
+                    static key_type key(const g2_value_type &Q) {
+                        return serializer_type::point_to_octets_compress(Q);
+                    }
+
+                    /// Precomputes the points and lays them out as a store, duplicate points are stored once
+                    static std::vector<std::uint8_t> build(const std::vector<g2_value_type> &points) {
+                        std::vector<std::pair<key_type, const g2_value_type *>> keys;
+                        keys.reserve(points.size());
+                        for (const g2_value_type &Q : points) {
+                            keys.emplace_back(key(Q), &Q);
+                        }
+                        std::sort(keys.begin(), keys.end(),
+                                  [](const auto &a, const auto &b) { return a.first < b.first; });
+                        keys.erase(std::unique(keys.begin(), keys.end(),
+                                               [](const auto &a, const auto &b) { return a.first == b.first; }),
+                                   keys.end());
+
+                        std::vector<std::uint8_t> result(octets_num(keys.size()));
+                        std::copy(magic.begin(), magic.end(), result.begin());
+                        write_uint64(std::tuple_size<key_type>::value, result.data() + 8);
+                        write_uint64(record_octets_num(), result.data() + 16);
+                        write_uint64(keys.size(), result.data() + 24);
+
+                        auto out = result.begin() + header_octets_num;
+                        for (const auto &[k, Q] : keys) {
+                            out = std::copy(k.begin(), k.end(), out);
+                            out = marshalling_type::to_bytes(PairingPolicy::precompute_g2::process(*Q), out);
+                        }
+
+                        return result;
+                    }
+
+                    precomputed_g2_store_view() : records(nullptr), records_count(0) {
+                    }
+
+                    /// The bytes have to outlive the view. An invalid range gives an empty view
+                    precomputed_g2_store_view(const std::uint8_t *data, std::size_t size) :
+                        records(nullptr), records_count(0) {
+                        if (data == nullptr || size < header_octets_num ||
+                            !std::equal(magic.begin(), magic.end(), data) ||
+                            read_uint64(data + 8) != std::tuple_size<key_type>::value ||
+                            read_uint64(data + 16) != record_octets_num()) {
+                            return;
+                        }
+
+                        const std::uint64_t count = read_uint64(data + 24);
+                        if (count > (size - header_octets_num) / record_octets_num()) {
+                            return;
+                        }
+
+                        records = data + header_octets_num;
+                        records_count = count;
+                    }
+
+                    bool empty() const {
+                        return records_count == 0;
+                    }
+
+                    std::size_t size() const {
+                        return records_count;
+                    }
+
+                    /**
+                     * Binary search for the key, the flag is false if it is absent or the record is malformed.
+                     * Only the binding of the record to its key is checked: a record whose stored point does not
+                     * compress to the key counts as absent, its coefficients are returned as they are.
+                     */
+                    std::pair<bool, g2_precomputed_type> find(const key_type &k) const {
+                        std::size_t first = 0, last = records_count;
+                        while (first < last) {
+                            const std::size_t middle = first + (last - first) / 2;
+                            const std::uint8_t *record = records + middle * record_octets_num();
+                            const int order = std::memcmp(record, k.data(), k.size());
+
+                            if (order == 0) {
+                                std::pair<bool, g2_precomputed_type> stored =
+                                    marshalling_type::from_bytes(record + k.size(), record + record_octets_num());
+                                if (stored.first && key(g2_value_type(stored.second.QX, stored.second.QY,
+                                                                      g2_field_value_type::one())) != k) {
+                                    return std::make_pair(false, g2_precomputed_type());
+                                }
+                                return stored;
+                            }
+                            if (order < 0) {
+                                first = middle + 1;
+                            } else {
+                                last = middle;
+                            }
+                        }
+
+                        return std::make_pair(false, g2_precomputed_type());
+                    }
+                };
+
+                template<typename CurveType, typename PairingPolicy>
+                constexpr std::array<std::uint8_t, 8> const
+                    precomputed_g2_store_view<CurveType, PairingPolicy>::magic;
+                template<typename CurveType, typename PairingPolicy>
+                constexpr std::size_t const precomputed_g2_store_view<CurveType, PairingPolicy>::header_octets_num;
+
+                /**
+                 * @brief LRU cache of G2 precomputations keyed by the compressed point.
+                 *
+                 * On a miss the precomputation is taken from the backing store if one is given and contains
+                 * the point, and computed otherwise. The backing store is trusted, see precomputed_g2_store_view.
+                 * Entries are shared, so an evicted precomputation stays valid while it is in use. The cache
+                 * is not synchronized.
+                 */
+                template<typename CurveType, typename PairingPolicy = pairing_policy<CurveType>>
+                class precomputed_g2_cache {
+                public:
+                    typedef precomputed_g2_store_view<CurveType, PairingPolicy> store_view_type;
+                    typedef typename store_view_type::g2_value_type g2_value_type;
+                    typedef typename store_view_type::g2_precomputed_type g2_precomputed_type;
+                    typedef typename store_view_type::key_type key_type;
+
+                private:
+                    typedef std::pair<key_type, std::shared_ptr<const g2_precomputed_type>> entry_type;
+
+                    std::size_t max_size;
+                    const store_view_type *store;
+
+                    std::list<entry_type> entries;    // most recently used first
+                    std::map<key_type, typename std::list<entry_type>::iterator> index;
+
+                public:
+                    explicit precomputed_g2_cache(std::size_t capacity,
+                                                  const store_view_type *backing_store = nullptr) :
+                        max_size(std::max<std::size_t>(capacity, 1)), store(backing_store) {
+                    }
+
+                    std::shared_ptr<const g2_precomputed_type> get(const g2_value_type &Q) {
+                        const key_type k = store_view_type::key(Q);
+
+                        const auto it = index.find(k);
+                        if (it != index.end()) {
+                            entries.splice(entries.begin(), entries, it->second);
+                            return it->second->second;
+                        }
+
+                        std::shared_ptr<const g2_precomputed_type> prec_Q;
+                        if (store != nullptr) {
+                            std::pair<bool, g2_precomputed_type> stored = store->find(k);
+                            if (stored.first) {
+                                prec_Q = std::make_shared<const g2_precomputed_type>(std::move(stored.second));
+                            }
+                        }
+                        if (!prec_Q) {
+                            prec_Q = std::make_shared<const g2_precomputed_type>(
+                                PairingPolicy::precompute_g2::process(Q));
+                        }
+
+                        entries.emplace_front(k, prec_Q);
+                        index[k] = entries.begin();
+
+                        if (entries.size() > max_size) {
+                            index.erase(entries.back().first);
+                            entries.pop_back();
+                        }
+
+                        return prec_Q;
+                    }
+
+                    bool contains(const g2_value_type &Q) const {
+                        return index.count(store_view_type::key(Q)) != 0;
+                    }
+
+                    std::size_t size() const {
+                        return entries.size();
+                    }
+
+                    std::size_t capacity() const {
+                        return max_size;
+                    }
+
+                    void clear() {
+                        entries.clear();
+                        index.clear();
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_PAIRING_PRECOMPUTED_G2_CACHE_HPP
@@ -0,0 +1,147 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PARALLELIZATION_HPP
+#define CRYPTO3_ALGEBRA_PARALLELIZATION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /**
+             * Executor running each submitted task on its own thread with std::async.
+             *
+             * Any type providing submit(task) which returns a std::future of the task result
+             * can be used instead, e.g. an adaptor over an application-wide thread pool.
+             */
+            struct async_executor {
+                template<typename Task>
+                std::future<decltype(std::declval<Task &>()())> submit(Task &&task) const {
+                    return std::async(std::launch::async, std::forward<Task>(task));
+                }
+            };
+
+            /**
+             * Executor deferring each submitted task until its result is requested,
+             * so everything is run on the calling thread.
+             */
+            struct sequential_executor {
+                template<typename Task>
+                std::future<decltype(std::declval<Task &>()())> submit(Task &&task) const {
+                    return std::async(std::launch::deferred, std::forward<Task>(task));
+                }
+            };
+
+            /**
+             * @return number of chunks the work is split into by default: one per hardware thread
+             */
+            inline std::size_t default_chunks_count() {
+                const std::size_t threads_count = std::thread::hardware_concurrency();
+                return threads_count == 0 ? 1 : threads_count;
+            }
+
+            namespace detail {
+                /**
+                 * Splits [0, size) into at most chunks_count contiguous ranges of nearly equal length,
+                 * evaluates func(begin, end) for each of them through the executor and returns
+                 * the results in range order.
+                 */
+                template<typename Executor, typename Function>
+                std::vector<decltype(std::declval<Function &>()(std::size_t(), std::size_t()))>
+                    parallel_chunks(Executor &&executor, const std::size_t size, std::size_t chunks_count,
+                                    Function func) {
+
+                    typedef decltype(std::declval<Function &>()(std::size_t(), std::size_t())) result_type;
+
+                    chunks_count = std::max<std::size_t>(1, std::min(chunks_count, size));
+
+                    const std::size_t chunk_size = size / chunks_count;
+                    const std::size_t remainder = size % chunks_count;
+
+                    std::vector<std::future<result_type>> futures;
+                    futures.reserve(chunks_count);
+
+                    std::size_t begin = 0;
+                    for (std::size_t i = 0; i < chunks_count; ++i) {
+                        const std::size_t end = begin + chunk_size + (i < remainder ? 1 : 0);
+                        futures.emplace_back(executor.submit([func, begin, end]() { return func(begin, end); }));
+                        begin = end;
+                    }
+
+                    std::vector<result_type> results;
+                    results.reserve(chunks_count);
+                    for (std::future<result_type> &future : futures) {
+                        results.emplace_back(future.get());
+                    }
+
+                    return results;
+                }
+
+                /**
+                 * Same as parallel_chunks, for functions which return nothing.
+                 */
+                template<typename Executor, typename Function>
+                void parallel_for_chunks(Executor &&executor, const std::size_t size, const std::size_t chunks_count,
+                                         Function func) {
+                    parallel_chunks(std::forward<Executor>(executor), size, chunks_count,
+                                    [func](std::size_t begin, std::size_t end) {
+                                        func(begin, end);
+                                        return true;
+                                    });
+                }
+
+                /**
+                 * Reduces non-empty values pairwise, level by level, so that the order of operations
+                 * depends only on values.size() and not on the order the values were computed in.
+                 */
+                template<typename ValueType, typename BinaryOperation>
+                ValueType tree_reduce(std::vector<ValueType> values, BinaryOperation op) {
+                    std::size_t count = values.size();
+
+                    while (count > 1) {
+                        const std::size_t half = count / 2;
+                        for (std::size_t i = 0; i < half; ++i) {
+                            values[i] = op(values[2 * i], values[2 * i + 1]);
+                        }
+                        if (count % 2 == 1) {
+                            values[half] = values[count - 1];
+                        }
+                        count = half + count % 2;
+                    }
+
+                    return values[0];
+                }
+            }    // namespace detail
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_PARALLELIZATION_HPP
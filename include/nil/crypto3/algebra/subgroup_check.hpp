@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_SUBGROUP_CHECK_HPP
+#define CRYPTO3_ALGEBRA_SUBGROUP_CHECK_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include <boost/random/random_device.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                /// Bit length of the scalar multiplication a single membership test of the group runs
+                template<typename CurveParams>
+                std::size_t subgroup_check_cost_bits() {
+                    typedef curves::detail::subgroup_check_params<CurveParams> params_type;
+                    typedef curves::detail::subgroup_check_type check_type;
+
+                    constexpr static const check_type type =
+                        curves::detail::subgroup_check_type_of<CurveParams>::value;
+
+                    if constexpr (type == check_type::sigma) {
+                        return 2 * (multiprecision::msb(params_type::u) + 1);
+                    } else if constexpr (type == check_type::psi) {
+                        return multiprecision::msb(params_type::z) + 1;
+                    } else {
+                        return CurveParams::scalar_field_type::modulus_bits;
+                    }
+                }
+            }    // namespace detail
+
+            /**
+             * @brief Checks that all the points of [first, last) lie in the prime order subgroup.
+             *
+             * For groups satisfying curves::detail::has_batch_subgroup_check, currently alt_bn128 G2 and
+             * BLS12-377 G2, the points are combined as sum(c_i * P_i) with random 64-bit c_i and only the
+             * sum is tested. A point outside of the subgroup survives a round with probability at most 1 / l,
+             * l the smallest prime factor of the cofactor, so ceil(security_bits / log2(l)) rounds are run.
+             * Small batches, for which that costs more than testing the points one by one, are tested one by
+             * one.
+             *
+             * The cofactors of BLS12 G1 and BLS12-381 G2 have prime factors too small for the combinations to
+             * ever pay off, so for these groups, as for those without an endomorphism based test, this is a
+             * loop over is_in_prime_subgroup.
+             *
+             * The points are expected to be on the curve, and the iterators to be random access.
+             */
+            template<typename InputIterator, typename RNG = boost::random_device>
+            bool batch_is_in_prime_subgroup(InputIterator first, InputIterator last,
+                                            const std::size_t security_bits = 128,
+                                            RNG &&rng = boost::random_device()) {
+                typedef typename std::iterator_traits<InputIterator>::value_type group_value_type;
+                typedef typename group_value_type::params_type curve_params_type;
+                typedef typename curve_params_type::scalar_field_type::value_type scalar_value_type;
+                typedef curves::detail::subgroup_check_params<curve_params_type> params_type;
+                typedef curves::detail::subgroup_check_type check_type;
+
+                constexpr static const check_type type =
+                    curves::detail::subgroup_check_type_of<curve_params_type>::value;
+                constexpr static const std::size_t coefficient_bits = 64;
+
+                const auto check_one_by_one = [first, last]() {
+                    return std::all_of(first, last, [](const group_value_type &point) {
+                        return curves::detail::check_prime_subgroup_membership(point);
+                    });
+                };
+
+                if constexpr (type == check_type::cofactor_one) {
+                    return true;
+                } else if constexpr (!curves::detail::has_batch_subgroup_check<curve_params_type>::value) {
+                    return check_one_by_one();
+                } else {
+                    const std::size_t size = std::distance(first, last);
+                    if (size == 0) {
+                        return true;
+                    }
+
+                    const std::size_t round_bits =
+                        std::max<std::size_t>(1, std::min(params_type::cofactor_min_prime_bits, coefficient_bits));
+                    const std::size_t rounds = (security_bits + round_bits - 1) / round_bits;
+
+                    // a round is a multiexp with window about log2(size), followed by a single test
+                    const std::size_t check_bits = detail::subgroup_check_cost_bits<curve_params_type>();
+                    const std::size_t window = std::max<std::size_t>(1, std::log2(size));
+                    if (rounds * (coefficient_bits * size / window + check_bits) >= size * check_bits) {
+                        return check_one_by_one();
+                    }
+
+                    boost::random::uniform_int_distribution<std::uint64_t> distribution;
+                    std::vector<scalar_value_type> coefficients(size);
+
+                    for (std::size_t round = 0; round < rounds; ++round) {
+                        for (scalar_value_type &coefficient : coefficients) {
+                            coefficient = scalar_value_type(distribution(rng));
+                        }
+
+                        const group_value_type combination = multiexp<policies::multiexp_method_BDLO12>(
+                            first, last, coefficients.begin(), coefficients.end());
+
+                        if (!curves::detail::check_prime_subgroup_membership(combination)) {
+                            return false;
+                        }
+                    }
+
+                    return true;
+                }
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_SUBGROUP_CHECK_HPP
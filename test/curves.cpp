@@ -64,6 +64,9 @@
 #include <nil/crypto3/algebra/fields/fp3.hpp>
 
 #include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+#include <nil/crypto3/algebra/subgroup_check.hpp>
+#include <nil/crypto3/algebra/batch_to_affine.hpp>
 
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
@@ -227,6 +230,94 @@ void check_curve_operations(const std::vector<typename CurveGroup::value_type> &
     // BOOST_CHECK_EQUAL(p2_copy, points[p2_to_special]);
 }
 
+template<typename CurveGroup>
+void check_glv_scalar_mul() {
+    using group_value_type = typename CurveGroup::value_type;
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+    using integral_type = typename scalar_field_type::integral_type;
+
+    static_assert(curves::detail::has_glv_scalar_mul<group_value_type, scalar_value_type>::value,
+                  "GLV multiplication is expected for the group");
+
+    using glv_params_type = curves::detail::glv_params<typename group_value_type::params_type>;
+    // phi(P) = lambda * P
+    group_value_type P = random_element<CurveGroup>();
+    BOOST_CHECK_EQUAL(curves::detail::glv_endomorphism(P),
+                      P * glv_params_type::lambda.data.template convert_to<integral_type>());
+
+    std::vector<scalar_value_type> scalars = {scalar_value_type::zero(), scalar_value_type::one(),
+                                              -scalar_value_type::one(), glv_params_type::lambda,
+                                              -glv_params_type::lambda};
+    for (std::size_t i = 0; i < 16; ++i) {
+        scalars.emplace_back(random_element<scalar_field_type>());
+    }
+
+    for (const scalar_value_type &s : scalars) {
+        // against the plain double-and-add of operator*
+        BOOST_CHECK_EQUAL(curves::detail::glv_scalar_mul(P, s), P * s.data.template convert_to<integral_type>());
+        BOOST_CHECK_EQUAL(curves::detail::mul_in_subgroup(P, s), P * s);
+    }
+    BOOST_CHECK_EQUAL(curves::detail::mul_in_subgroup(group_value_type::zero(), scalars.back()),
+                      group_value_type::zero());
+}
+
+template<typename CurveGroup>
+void check_generator_comb() {
+    using group_value_type = typename CurveGroup::value_type;
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+    using integral_type = typename scalar_field_type::integral_type;
+
+    static_assert(curves::detail::has_generator_comb<group_value_type, scalar_value_type>::value,
+                  "Generator multiplication is expected to go through the comb");
+
+    const group_value_type g = group_value_type::one();
+
+    std::vector<scalar_value_type> scalars = {scalar_value_type::zero(), scalar_value_type::one(),
+                                              scalar_value_type(2), -scalar_value_type::one(),
+                                              -scalar_value_type(2)};
+    for (std::size_t i = 0; i < 16; ++i) {
+        scalars.emplace_back(random_element<scalar_field_type>());
+    }
+
+    for (const scalar_value_type &s : scalars) {
+        // integral scalars go through the plain double-and-add
+        BOOST_CHECK_EQUAL(g * s, g * s.data.template convert_to<integral_type>());
+        BOOST_CHECK_EQUAL(s * g, g * s.data.template convert_to<integral_type>());
+        if constexpr (curves::detail::has_glv_scalar_mul<group_value_type, scalar_value_type>::value) {
+            BOOST_CHECK_EQUAL(g * s, curves::detail::glv_scalar_mul(g, s));
+        }
+    }
+    BOOST_CHECK(random_element<CurveGroup>().is_well_formed());
+}
+
+template<typename CurveGroup>
+void check_prime_subgroup_membership(const typename CurveGroup::value_type &outsider) {
+    using group_value_type = typename CurveGroup::value_type;
+
+    std::vector<group_value_type> points = {group_value_type::zero(), group_value_type::one()};
+    for (std::size_t i = 0; i < 4; ++i) {
+        points.emplace_back(random_element<CurveGroup>());
+    }
+    for (const group_value_type &p : points) {
+        BOOST_CHECK(p.is_in_prime_subgroup());
+    }
+    BOOST_CHECK(!outsider.is_in_prime_subgroup());
+    BOOST_CHECK(!(outsider + points.back()).is_in_prime_subgroup());
+
+    // large enough for the random linear combination to pay off where the cofactor allows it
+    while (points.size() < 256) {
+        points.emplace_back(points.back() + points[points.size() - 4]);
+    }
+    BOOST_CHECK(batch_is_in_prime_subgroup(points.begin(), points.end()));
+    BOOST_CHECK(batch_is_in_prime_subgroup(points.begin(), points.begin() + 8));
+    BOOST_CHECK(batch_is_in_prime_subgroup(points.begin(), points.begin()));
+
+    points[points.size() / 2] = points[points.size() / 2] + outsider;
+    BOOST_CHECK(!batch_is_in_prime_subgroup(points.begin(), points.end()));
+}
+
 // temporary separated test for JubJub and BabyJubJub
 template<typename CurveGroup>
 void check_curve_operations_twisted_edwards(
@@ -422,6 +513,29 @@ void curve_operation_test_montgomery(const TestSet &test_set,
     check_montgomery_twisted_edwards_conversion(points, constants);
 }
 
+template<typename GroupType>
+void check_batch_to_affine() {
+    using value_type = typename GroupType::value_type;
+
+    std::vector<value_type> points = {value_type::zero()};
+    value_type p = value_type::one();
+    for (std::size_t i = 0; i < 20; ++i) {
+        points.push_back(p);
+        p = p.doubled() + value_type::one();
+    }
+    points.push_back(value_type::zero());
+    points.push_back(-points[5]);
+
+    const auto affine_points = batch_to_affine(points);
+    const auto sliced_affine_points = batch_to_affine(points, 4, sequential_executor());
+    BOOST_CHECK_EQUAL(affine_points.size(), points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        const auto expected = points[i].to_affine();
+        BOOST_CHECK(affine_points[i].X == expected.X && affine_points[i].Y == expected.Y);
+        BOOST_CHECK(sliced_affine_points[i].X == expected.X && sliced_affine_points[i].Y == expected.Y);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(curves_manual_tests)
 /**/
 
@@ -618,4 +732,137 @@ BOOST_DATA_TEST_CASE(curve_operation_test_vesta, string_data("curve_operation_te
                                                       fp_curve_test_init<policy_type>);
 }
 
+BOOST_AUTO_TEST_CASE(glv_scalar_mul_test) {
+    check_glv_scalar_mul<curves::bls12<381>::g1_type<>>();
+    check_glv_scalar_mul<curves::bls12<377>::g1_type<>>();
+    check_glv_scalar_mul<curves::alt_bn128<254>::g1_type<>>();
+    check_glv_scalar_mul<curves::secp_k1<256>::g1_type<>>();
+    check_glv_scalar_mul<curves::pallas::g1_type<>>();
+    check_glv_scalar_mul<curves::vesta::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(generator_comb_test) {
+    check_generator_comb<curves::bls12<381>::g1_type<>>();
+    check_generator_comb<curves::bls12<381>::g2_type<>>();
+    check_generator_comb<curves::alt_bn128<254>::g1_type<>>();
+    check_generator_comb<curves::secp_k1<256>::g1_type<>>();
+    check_generator_comb<curves::secp_r1<256>::g1_type<>>();
+    check_generator_comb<curves::pallas::g1_type<>>();
+    check_generator_comb<curves::jubjub::g1_type<curves::coordinates::extended_with_a_minus_1>>();
+    check_generator_comb<curves::ed25519::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(prime_subgroup_membership_test) {
+    using bls12_381_g1 = curves::bls12<381>::g1_type<>;
+    using bls12_381_g2 = curves::bls12<381>::g2_type<>;
+    using bls12_377_g1 = curves::bls12<377>::g1_type<>;
+    using bls12_377_g2 = curves::bls12<377>::g2_type<>;
+    using alt_bn128_g1 = curves::alt_bn128<254>::g1_type<>;
+    using alt_bn128_g2 = curves::alt_bn128<254>::g2_type<>;
+
+    // random linear combinations only where the cofactor has no small prime factors
+    static_assert(!curves::detail::has_batch_subgroup_check<typename bls12_381_g1::value_type::params_type>::value,
+                  "BLS12-381 G1 points are expected to be tested one by one");
+    static_assert(!curves::detail::has_batch_subgroup_check<typename bls12_381_g2::value_type::params_type>::value,
+                  "BLS12-381 G2 points are expected to be tested one by one");
+    static_assert(!curves::detail::has_batch_subgroup_check<typename bls12_377_g1::value_type::params_type>::value,
+                  "BLS12-377 G1 points are expected to be tested one by one");
+    static_assert(curves::detail::has_batch_subgroup_check<typename bls12_377_g2::value_type::params_type>::value,
+                  "BLS12-377 G2 points are expected to be tested in batches");
+    static_assert(curves::detail::has_batch_subgroup_check<typename alt_bn128_g2::value_type::params_type>::value,
+                  "alt_bn128 G2 points are expected to be tested in batches");
+
+    // (0, 2) and (0, 1) are of order 3
+    check_prime_subgroup_membership<bls12_381_g1>(typename bls12_381_g1::value_type(
+        bls12_381_g1::field_type::value_type::zero(), bls12_381_g1::field_type::value_type(2),
+        bls12_381_g1::field_type::value_type::one()));
+    check_prime_subgroup_membership<bls12_377_g1>(typename bls12_377_g1::value_type(
+        bls12_377_g1::field_type::value_type::zero(), bls12_377_g1::field_type::value_type::one(),
+        bls12_377_g1::field_type::value_type::one()));
+
+    // twist points with the smallest x = (k, 0)
+    using bls12_381_fq2 = typename bls12_381_g2::field_type::value_type;
+    check_prime_subgroup_membership<bls12_381_g2>(typename bls12_381_g2::value_type(
+        bls12_381_fq2(2, 0),
+        bls12_381_fq2(
+            0x18C6B864AE17DC9DA64203FFEFB966306425A7BC6AEB7C75247438372716284A4173830420CD476BA1A365B95BFCEC38_cppui381,
+            0x172E93DB764A8400A7D5071B6B6F5DE0DA2F0F4A063119ABCA014006B7C40A2CFE291A1924E65DB0D6D0FCFBF3BF3D5C_cppui381),
+        bls12_381_fq2::one()));
+    using bls12_377_fq2 = typename bls12_377_g2::field_type::value_type;
+    check_prime_subgroup_membership<bls12_377_g2>(typename bls12_377_g2::value_type(
+        bls12_377_fq2(2, 0),
+        bls12_377_fq2(
+            0x17EC7B8AAFA9390CE7E93B4AE59691F23C4E04BD4480EFBFC6CA6D1518764AA45BDBDF03E9BCBA347F3951CD2475AD6_cppui377,
+            0x9CB7E17B71E87A17785CDEC275DB96340F87DB51D759C1BD791CDA4B977E0E18BF327CC5A93CFC451BAC7933CBAD5C_cppui376),
+        bls12_377_fq2::one()));
+    using alt_bn128_fq2 = typename alt_bn128_g2::field_type::value_type;
+    check_prime_subgroup_membership<alt_bn128_g2>(typename alt_bn128_g2::value_type(
+        alt_bn128_fq2(1, 0),
+        alt_bn128_fq2(0x2869111D5381F072F8E2728FDB825A51AADD70E52C9830E9AB4B871C0531F1BB_cppui254,
+                      0xD1271953ED9EA0836846E70A1934187998C7F790CB4D7511B7F8DA82DE048A4_cppui252),
+        alt_bn128_fq2::one()));
+
+    // the cofactor of alt_bn128 G1 is one
+    BOOST_CHECK(random_element<alt_bn128_g1>().is_in_prime_subgroup());
+}
+
+BOOST_AUTO_TEST_CASE(batch_decompression_test_bls12_381) {
+    using curve_type = curves::bls12_381;
+    using serializer = nil::marshalling::curve_element_serializer<curve_type>;
+    using g1_value_type = typename curve_type::g1_type<>::value_type;
+    using g2_value_type = typename curve_type::g2_type<>::value_type;
+
+    std::vector<g1_value_type> g1_points = {g1_value_type::zero(), g1_value_type::one()};
+    std::vector<g2_value_type> g2_points = {g2_value_type::zero(), g2_value_type::one()};
+    for (std::size_t i = 0; i < 14; ++i) {
+        g1_points.emplace_back(random_element<curve_type::g1_type<>>());
+        g2_points.emplace_back(random_element<curve_type::g2_type<>>());
+    }
+
+    std::vector<typename serializer::compressed_g1_octets> g1_octets;
+    std::vector<typename serializer::compressed_g2_octets> g2_octets;
+    for (std::size_t i = 0; i < g1_points.size(); ++i) {
+        g1_octets.emplace_back(serializer::point_to_octets_compress(g1_points[i]));
+        g2_octets.emplace_back(serializer::point_to_octets_compress(g2_points[i]));
+    }
+
+    auto g1_decoded = serializer::compressed_octets_to_g1_points(g1_octets, 3);
+    auto g2_decoded = serializer::compressed_octets_to_g2_points(g2_octets, 3, sequential_executor());
+    BOOST_CHECK(g1_decoded.first);
+    BOOST_CHECK(g2_decoded.first);
+    BOOST_CHECK_EQUAL(g1_decoded.second.size(), g1_points.size());
+    BOOST_CHECK_EQUAL(g2_decoded.second.size(), g2_points.size());
+    for (std::size_t i = 0; i < g1_points.size(); ++i) {
+        BOOST_CHECK(g1_decoded.second[i] == g1_points[i]);
+        BOOST_CHECK(g2_decoded.second[i] == g2_points[i]);
+        BOOST_CHECK(g1_decoded.second[i] == serializer::octets_to_g1_point(g1_octets[i]));
+        BOOST_CHECK(g2_decoded.second[i] == serializer::octets_to_g2_point(g2_octets[i]));
+    }
+
+    // compression flag cleared, x out of range
+    g1_octets[1][0] &= 0x7F;
+    g2_octets[2][0] |= 0x1F;
+    g1_decoded = serializer::compressed_octets_to_g1_points(g1_octets);
+    g2_decoded = serializer::compressed_octets_to_g2_points(g2_octets);
+    BOOST_CHECK(!g1_decoded.first);
+    BOOST_CHECK(!g2_decoded.first);
+    BOOST_CHECK(g1_decoded.second[1].is_zero());
+    BOOST_CHECK(g2_decoded.second[2].is_zero());
+    BOOST_CHECK(g1_decoded.second[3] == g1_points[3]);
+}
+
+BOOST_AUTO_TEST_CASE(batch_to_affine_test) {
+    check_batch_to_affine<curves::bls12<381>::g1_type<>>();
+    check_batch_to_affine<curves::bls12<381>::g1_type<curves::coordinates::projective>>();
+    check_batch_to_affine<curves::bls12<381>::g2_type<>>();
+    check_batch_to_affine<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian>>();
+    check_batch_to_affine<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian_with_a4_minus_3>>();
+    check_batch_to_affine<curves::secp_r1<256>::g1_type<curves::coordinates::projective_with_a4_minus_3>>();
+    check_batch_to_affine<curves::mnt4<298>::g2_type<>>();
+    check_batch_to_affine<curves::edwards<183>::g1_type<>>();
+    check_batch_to_affine<curves::edwards<183>::g1_type<curves::coordinates::inverted, curves::forms::edwards>>();
+    check_batch_to_affine<curves::jubjub::g1_type<curves::coordinates::extended_with_a_minus_1>>();
+    check_batch_to_affine<curves::jubjub::g1_type<>>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -26,9 +26,12 @@
 
 #define BOOST_TEST_MODULE algebra_fields_test
 
+#include <algorithm>
 #include <iostream>
 #include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -48,6 +51,10 @@
 // #include <nil/crypto3/algebra/fields/bn128/scalar_field.hpp>
 #include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
 #include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/alt_bn128/base_field.hpp>
+#include <nil/crypto3/algebra/fields/alt_bn128/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/pallas/base_field.hpp>
+#include <nil/crypto3/algebra/fields/vesta/base_field.hpp>
 #include <nil/crypto3/algebra/fields/mnt4/base_field.hpp>
 #include <nil/crypto3/algebra/fields/mnt4/scalar_field.hpp>
 #include <nil/crypto3/algebra/fields/mnt6/base_field.hpp>
@@ -68,6 +75,9 @@
 
 #include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/fp2.hpp>
+#include <nil/crypto3/algebra/fields/detail/batch_inversion.hpp>
+
+#include <nil/crypto3/multiprecision/wnaf.hpp>
 
 using namespace nil::crypto3::algebra;
 
@@ -449,6 +459,251 @@ void field_not_square_test(const std::vector<std::array<const char *, 2>> &test_
     }
 }
 
+template<typename FieldType>
+void fixed_montgomery_test() {
+    using value_type = typename FieldType::value_type;
+    using integral_type = typename FieldType::integral_type;
+    using extended_integral_type = typename FieldType::extended_integral_type;
+
+    BOOST_CHECK(value_type::is_fixed_montgomery);
+
+    extended_integral_type modulus_from_limbs = 0;
+    for (std::size_t i = FieldType::montgomery_modulus_limbs.size() - 1; i < FieldType::montgomery_modulus_limbs.size();
+         --i) {
+        modulus_from_limbs = (modulus_from_limbs << 64) | FieldType::montgomery_modulus_limbs[i];
+    }
+    const extended_integral_type p = FieldType::modulus;
+    BOOST_CHECK(modulus_from_limbs == p);
+
+    // walk through pseudo-random elements, checking every product against plain integer arithmetic
+    value_type x(7), y(integral_type(FieldType::modulus - 2));
+    extended_integral_type ex = 7, ey = p - 2;
+    for (std::size_t i = 0; i < 64; ++i) {
+        BOOST_CHECK((x * y).data.template convert_to<integral_type>() == integral_type((ex * ey) % p));
+        BOOST_CHECK(x.squared().data.template convert_to<integral_type>() == integral_type((ex * ex) % p));
+
+        value_type z = x;
+        z *= y;
+        BOOST_CHECK(z == x * y);
+        BOOST_CHECK(z / y == x);
+
+        x = x * y + x.squared();
+        ex = (ex * ey + ex * ex) % p;
+        y = y.squared() + value_type(i);
+        ey = (ey * ey + i) % p;
+    }
+}
+
+template<typename FieldType>
+void lazy_reduction_test() {
+    using fp_type = typename FieldType::value_type;
+    using fp2_type = typename fields::fp2<FieldType>::value_type;
+    using fp6_type = typename fields::fp6_3over2<FieldType>::value_type;
+    using fp12_type = typename fields::fp12_2over3over2<FieldType>::value_type;
+
+    BOOST_CHECK(fp_type::lazy_reduction);
+    BOOST_CHECK(fp2_type::lazy_reduction);
+    BOOST_CHECK(fp6_type::lazy_reduction);
+    BOOST_CHECK(fp12_type::lazy_reduction);
+
+    fp_type a(3), b(fp_type(5).inversed());
+    for (std::size_t i = 0; i < 16; ++i) {
+        std::array<fp_type, 12> x, y;
+        for (std::size_t j = 0; j < 12; ++j) {
+            x[j] = a;
+            y[j] = b - a;
+            a = a * b + fp_type(j);
+            b = b.squared() - a;
+        }
+
+        // compare against schoolbook formulas with a reduction per product
+        const fp2_type x2(x[0], x[1]), y2(y[0], y[1]);
+        const fp_type non_residue2 = fp2_type::non_residue;
+        BOOST_CHECK(x2 * y2 == fp2_type(x[0] * y[0] + non_residue2 * x[1] * y[1], x[0] * y[1] + x[1] * y[0]));
+        BOOST_CHECK(x2.squared() == fp2_type(x[0] * x[0] + non_residue2 * x[1] * x[1], (x[0] * x[1]).doubled()));
+
+        const fp6_type x6(x2, fp2_type(x[2], x[3]), fp2_type(x[4], x[5])),
+            y6(y2, fp2_type(y[2], y[3]), fp2_type(y[4], y[5]));
+        const fp2_type non_residue6 = fp6_type::non_residue;
+        BOOST_CHECK(x6 * y6 ==
+                    fp6_type(x6.data[0] * y6.data[0] +
+                                 non_residue6 * (x6.data[1] * y6.data[2] + x6.data[2] * y6.data[1]),
+                             x6.data[0] * y6.data[1] + x6.data[1] * y6.data[0] +
+                                 non_residue6 * x6.data[2] * y6.data[2],
+                             x6.data[0] * y6.data[2] + x6.data[1] * y6.data[1] + x6.data[2] * y6.data[0]));
+
+        const fp12_type x12(x6, fp6_type(fp2_type(x[6], x[7]), fp2_type(x[8], x[9]), fp2_type(x[10], x[11]))),
+            y12(y6, fp6_type(fp2_type(y[6], y[7]), fp2_type(y[8], y[9]), fp2_type(y[10], y[11])));
+        const fp6_type v_x1y1 = x12.mul_by_non_residue(x12.data[1] * y12.data[1]);
+        BOOST_CHECK(x12 * y12 == fp12_type(x12.data[0] * y12.data[0] + v_x1y1,
+                                           x12.data[0] * y12.data[1] + x12.data[1] * y12.data[0]));
+        BOOST_CHECK(x12.squared() == x12 * x12);
+        BOOST_CHECK((x12 * y12) * x12.inversed() == y12);
+    }
+}
+
+template<typename FieldType>
+void sparse_line_test() {
+    using fp_type = typename FieldType::value_type;
+    using fp2_type = typename fields::fp2<FieldType>::value_type;
+    using fp6_type = typename fields::fp6_3over2<FieldType>::value_type;
+    using fp12_type = typename fields::fp12_2over3over2<FieldType>::value_type;
+
+    const fp2_type zero = fp2_type::zero();
+
+    fp_type a(7), b(fp_type(3).inversed());
+    for (std::size_t i = 0; i < 8; ++i) {
+        std::array<fp2_type, 12> x;
+        for (std::size_t j = 0; j < 12; ++j) {
+            x[j] = fp2_type(a, b);
+            a = a * b + fp_type(j);
+            b = b.squared() - a;
+        }
+
+        const fp12_type f(fp6_type(x[0], x[1], x[2]), fp6_type(x[3], x[4], x[5]));
+        // line coefficients (ell_0, ell_VW, ell_VV)
+        const fp2_type &l0 = x[6], &l1 = x[7], &l2 = x[8], &m0 = x[9], &m1 = x[10], &m2 = x[11];
+
+        const fp12_type m_line1(fp6_type(l1, zero, zero), fp6_type(zero, l0, l2)),
+            m_line2(fp6_type(m1, zero, zero), fp6_type(zero, m0, m2));
+        const fp12_type d_line1(fp6_type(l0, zero, l2), fp6_type(zero, l1, zero)),
+            d_line2(fp6_type(m0, zero, m2), fp6_type(zero, m1, zero));
+
+        BOOST_CHECK(f.mul_by_045(l0, l1, l2) == f * m_line1);
+        BOOST_CHECK(f.mul_by_024(l0, l1, l2) == f * d_line1);
+
+        const fp12_type m_lines = fp12_type::mul_045_by_045(l0, l1, l2, m0, m1, m2);
+        BOOST_CHECK(m_lines == m_line1 * m_line2);
+        BOOST_CHECK(f.mul_by_01245(m_lines) == f * m_lines);
+
+        const fp12_type d_lines = fp12_type::mul_024_by_024(l0, l1, l2, m0, m1, m2);
+        BOOST_CHECK(d_lines == d_line1 * d_line2);
+        BOOST_CHECK(f.mul_by_01234(d_lines) == f * d_lines);
+    }
+}
+
+template<typename FieldType>
+void cyclotomic_compressed_test() {
+    using fp_type = typename FieldType::value_type;
+    using fp2_type = typename fields::fp2<FieldType>::value_type;
+    using fp6_type = typename fields::fp6_3over2<FieldType>::value_type;
+    using fp12_type = typename fields::fp12_2over3over2<FieldType>::value_type;
+
+    fp_type a(11), b(fp_type(5).inversed());
+    std::array<fp2_type, 6> x;
+    for (std::size_t j = 0; j < 6; ++j) {
+        x[j] = fp2_type(a, b);
+        a = a * b + fp_type(j);
+        b = b.squared() - a;
+    }
+
+    // map into the cyclotomic subgroup: g = x^((p^6 - 1) * (p^2 + 1))
+    const fp12_type y(fp6_type(x[0], x[1], x[2]), fp6_type(x[3], x[4], x[5]));
+    fp12_type g = y.unitary_inversed() * y.inversed();
+    g = g.Frobenius_map(2) * g;
+    BOOST_CHECK(g.cyclotomic_squared() == g.squared());
+
+    fp12_type compressed = g, expected = g;
+    std::vector<fp12_type> batch, batch_expected;
+    for (std::size_t i = 0; i < 20; ++i) {
+        compressed = compressed.cyclotomic_squared_compressed();
+        expected = expected.cyclotomic_squared();
+        BOOST_CHECK(compressed.decompressed() == expected);
+        if (i % 3 == 0) {
+            batch.push_back(compressed);
+            batch_expected.push_back(expected);
+        }
+    }
+    fp12_type::batch_decompress(batch);
+    BOOST_CHECK(batch == batch_expected);
+
+    const typename FieldType::integral_type e = 0xD201000000010000_cppui64;
+    const fp12_type g_e = g.pow(e);
+    BOOST_CHECK(g.cyclotomic_exp(e) == g_e);
+
+    // more set bits than a window of compressed powers
+    const typename FieldType::integral_type e_dense = 0x44E992B44A6909F1_cppui64;
+    BOOST_CHECK(g.cyclotomic_exp(e_dense) == g.pow(e_dense));
+
+    std::vector<long> naf = nil::crypto3::multiprecision::find_wnaf(1, e);
+    BOOST_CHECK(g.cyclotomic_exp_naf(naf) == g_e);
+    for (long &digit : naf) {
+        digit = -digit;
+    }
+    BOOST_CHECK(g.cyclotomic_exp_naf(naf) == g_e.unitary_inversed());
+}
+
+template<typename FieldType>
+void batch_inverse_test() {
+    using value_type = typename FieldType::value_type;
+
+    std::vector<value_type> elements;
+    value_type x = value_type::one().doubled();
+    for (std::size_t i = 0; i < 37; ++i) {
+        elements.push_back(i % 8 == 3 ? value_type::zero() : x);
+        x = x.squared() + value_type::one();
+    }
+
+    const std::vector<value_type> inverses = fields::batch_inverse(elements);
+    BOOST_CHECK_EQUAL(inverses.size(), elements.size());
+    for (std::size_t i = 0; i < elements.size(); ++i) {
+        BOOST_CHECK(inverses[i] == (elements[i].is_zero() ? value_type::zero() : elements[i].inversed()));
+    }
+
+    BOOST_CHECK(fields::batch_inverse(elements, 4, sequential_executor()) == inverses);
+    BOOST_CHECK(fields::batch_inverse(elements, 64, async_executor()) == inverses);
+
+    std::vector<value_type> out(elements.size());
+    BOOST_CHECK(fields::batch_inverse(elements.cbegin() + 1, elements.cend(), out.begin()) == out.end() - 1);
+    BOOST_CHECK(std::equal(out.begin(), out.end() - 1, inverses.begin() + 1));
+    BOOST_CHECK(fields::batch_inverse(std::vector<value_type>()).empty());
+}
+
+template<typename FieldType>
+void safegcd_inversion_test() {
+    using value_type = typename FieldType::value_type;
+    using integral_type = typename FieldType::integral_type;
+
+    BOOST_CHECK(value_type::zero().inversed() == value_type::zero());
+    BOOST_CHECK(value_type::zero().inversed_vartime() == value_type::zero());
+    BOOST_CHECK(value_type::zero().is_square());
+
+    // Euler's criterion
+    const integral_type legendre_exponent = integral_type((FieldType::modulus - 1) / 2);
+
+    value_type x(integral_type(FieldType::modulus - 1)), y(3);
+    std::size_t squares = 0;
+    for (std::size_t i = 0; i < 64; ++i) {
+        BOOST_CHECK(x * x.inversed() == value_type::one());
+        BOOST_CHECK(x.inversed_vartime() == x.inversed());
+        BOOST_CHECK(x.is_square() == x.pow(legendre_exponent).is_one());
+        BOOST_CHECK(x.squared().is_square());
+        squares += x.is_square();
+
+        x = x * y + value_type(i);
+        y = y.squared() - x;
+    }
+    BOOST_CHECK(squares != 0 && squares != 64);
+}
+
+template<typename FieldType>
+void fp2_norm_inversion_test() {
+    using fp_type = typename FieldType::value_type;
+    using fp2_type = typename fields::fp2<FieldType>::value_type;
+
+    fp_type a(5), b(fp_type(7).inversed());
+    for (std::size_t i = 0; i < 32; ++i) {
+        const fp2_type z(a, b);
+        BOOST_CHECK(z * z.inversed() == fp2_type::one());
+        BOOST_CHECK(z.inversed_vartime() == z.inversed());
+        BOOST_CHECK(z.squared().is_square());
+        BOOST_CHECK(z.is_square() == z.pow(fields::fp2<FieldType>::extension_policy::group_order).is_one());
+
+        a = a * b + fp_type(i);
+        b = b.squared() - a;
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(fields_manual_tests)
 
 BOOST_DATA_TEST_CASE(field_operation_test_bls12_381_fr, string_data("field_operation_test_bls12_381_fr"), data_set) {
@@ -966,4 +1221,49 @@ BOOST_AUTO_TEST_CASE(field_not_square_manual_test_bls12_381_fq2) {
     field_not_square_test<policy_type>(not_squares);
 }
 
+BOOST_AUTO_TEST_CASE(fixed_montgomery_test_case) {
+    fixed_montgomery_test<fields::bls12_fq<381>>();
+    fixed_montgomery_test<fields::bls12_fr<381>>();
+    fixed_montgomery_test<fields::alt_bn128_fq<254>>();
+    fixed_montgomery_test<fields::alt_bn128_fr<254>>();
+    fixed_montgomery_test<fields::pallas_base_field>();
+    fixed_montgomery_test<fields::vesta_base_field>();
+    fixed_montgomery_test<fields::secp_k1_fq<256>>();
+    fixed_montgomery_test<fields::secp_k1_fr<256>>();
+}
+
+BOOST_AUTO_TEST_CASE(lazy_reduction_test_case) {
+    lazy_reduction_test<fields::bls12_fq<381>>();
+    lazy_reduction_test<fields::alt_bn128_fq<254>>();
+}
+
+BOOST_AUTO_TEST_CASE(sparse_line_test_case) {
+    sparse_line_test<fields::bls12_fq<381>>();
+    sparse_line_test<fields::alt_bn128_fq<254>>();
+}
+
+BOOST_AUTO_TEST_CASE(cyclotomic_compressed_test_case) {
+    cyclotomic_compressed_test<fields::bls12_fq<381>>();
+    cyclotomic_compressed_test<fields::alt_bn128_fq<254>>();
+}
+
+BOOST_AUTO_TEST_CASE(batch_inverse_test_case) {
+    batch_inverse_test<fields::bls12_fq<381>>();
+    batch_inverse_test<fields::fp2<fields::bls12_fq<381>>>();
+    batch_inverse_test<fields::fp12_2over3over2<fields::bls12_fq<381>>>();
+    batch_inverse_test<fields::fp3<fields::mnt6<298>>>();
+}
+
+BOOST_AUTO_TEST_CASE(safegcd_inversion_test_case) {
+    safegcd_inversion_test<fields::bls12_fq<381>>();
+    safegcd_inversion_test<fields::bls12_fr<381>>();
+    safegcd_inversion_test<fields::alt_bn128_fq<254>>();
+    safegcd_inversion_test<fields::pallas_base_field>();
+    safegcd_inversion_test<fields::secp_k1_fq<256>>();
+    safegcd_inversion_test<fields::secp_k1_fr<256>>();
+
+    fp2_norm_inversion_test<fields::bls12_fq<381>>();
+    fp2_norm_inversion_test<fields::alt_bn128_fq<254>>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
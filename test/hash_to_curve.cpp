@@ -31,6 +31,8 @@
 #include <string>
 #include <type_traits>
 #include <tuple>
+#include <list>
+#include <iterator>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -43,9 +45,15 @@
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_expand.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
 
 #include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
 
+#include <nil/crypto3/algebra/random_element.hpp>
+
 #include <nil/crypto3/hash/sha2.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <nil/crypto3/hash/accumulators/hash.hpp>
@@ -139,6 +147,13 @@ void check_expand_message(std::size_t len_in_bytes, const DstType &dst, const Ms
     std::vector<std::uint8_t> uniform_bytes(len_in_bytes, 0);
     Expander::template process(len_in_bytes, msg, dst, uniform_bytes);
     BOOST_CHECK(result_compare(uniform_bytes));
+
+    // the same through a prepared tag, with the message streamed from a list
+    const typename Expander::dst_context context(dst);
+    std::list<std::uint8_t> msg_list(msg.begin(), msg.end());
+    std::vector<std::uint8_t> streamed_bytes;
+    context.process(len_in_bytes, msg_list.begin(), msg_list.end(), std::back_inserter(streamed_bytes));
+    BOOST_CHECK(result_compare(streamed_bytes));
 }
 
 template<std::size_t N,
@@ -164,6 +179,69 @@ void check_hash_to_curve(const std::string &msg_str, const GroupValueType &expec
     std::vector<std::uint8_t> msg(msg_str.begin(), msg_str.end());
     GroupValueType result = H2CType::hash_to_curve(msg, dst);
     BOOST_CHECK_EQUAL(result, expected);
+    BOOST_CHECK_EQUAL(H2CType::hash_to_curve(msg, typename H2CType::expand_message_ro::dst_context(dst)), expected);
+}
+
+template<typename GroupType>
+void check_sqrt_ratio() {
+    using suite_type = h2c_suite<GroupType>;
+    using field_type = typename GroupType::field_type;
+    using field_value_type = typename field_type::value_type;
+
+    for (std::size_t i = 0; i < 16; i++) {
+        const field_value_type u = i == 0 ? field_value_type::zero() : random_element<field_type>();
+        const field_value_type v = random_element<field_type>();
+        field_value_type y;
+        const bool is_qr = m2c_simple_swu<GroupType>::sqrt_ratio(u, v, y);
+        if (!u.is_zero()) {
+            BOOST_CHECK_EQUAL(is_qr, (u / v).is_square());
+        }
+        BOOST_CHECK_EQUAL(y.squared() * v, is_qr ? u : suite_type::Z * u);
+    }
+}
+
+template<typename H2CType, typename GroupType>
+void check_clear_cofactor() {
+    using suite_type = h2c_suite<GroupType>;
+    using field_type = typename GroupType::field_type;
+    using group_value_type = typename GroupType::value_type;
+
+    for (std::size_t i = 0; i < 8; i++) {
+        // points of the curve outside of the prime order subgroup
+        const group_value_type R = map_to_curve<GroupType>::process(random_element<field_type>());
+        const group_value_type Q = H2CType::clear_cofactor(R);
+        BOOST_CHECK_EQUAL(Q, R * suite_type::h_eff);
+        BOOST_CHECK(Q.is_in_prime_subgroup());
+    }
+    BOOST_CHECK(H2CType::clear_cofactor(group_value_type::zero()).is_zero());
+}
+
+template<typename H2CType>
+void check_hash_to_curve_batch() {
+    using group_value_type = typename H2CType::group_value_type;
+
+    std::string tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(tag_str.begin(), tag_str.end());
+    dst.insert(dst.end(), H2CType::suite_type::suite_id.begin(), H2CType::suite_type::suite_id.end());
+
+    std::list<std::vector<std::uint8_t>> msgs;
+    for (std::size_t i = 0; i < 13; i++) {
+        msgs.emplace_back(i, std::uint8_t('a' + i));
+    }
+
+    std::vector<group_value_type> result;
+    H2CType::hash_to_curve_batch(msgs, dst, std::back_inserter(result), 4, sequential_executor());
+    BOOST_CHECK_EQUAL(result.size(), msgs.size());
+
+    std::vector<group_value_type> parallel_result;
+    H2CType::hash_to_curve_batch(msgs, dst, std::back_inserter(parallel_result));
+    BOOST_CHECK(parallel_result == result);
+
+    auto msg_it = msgs.begin();
+    for (std::size_t i = 0; i < result.size(); i++, ++msg_it) {
+        BOOST_CHECK_EQUAL(result[i], H2CType::hash_to_curve(*msg_it, dst));
+        BOOST_CHECK(result[i].Z.is_one());
+    }
 }
 
 BOOST_AUTO_TEST_SUITE(h2c_manual_tests)
@@ -598,4 +676,251 @@ BOOST_AUTO_TEST_CASE(hash_to_curve_bls12_381_g2_h2c_sha256_test) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(hash_to_curve_secp256k1_h2c_sha256_test) {
+    // https://www.rfc-editor.org/rfc/rfc9380#appendix-J.8.1
+    using curve_type = secp256k1;
+    using group_type = typename curve_type::g1_type<>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"",
+         group_value_type(integral_type("876548465844228498365719301564664383799"
+                                        "84710599888121545025567473301233275718"),
+                          integral_type("456737113335161745008929872530360944041"
+                                        "76536844955599116957274814081860440167"),
+                          1)},
+        {"abc",
+         group_value_type(integral_type("232797568964711995230108700528674150784"
+                                        "63234370173863328176697381984636972107"),
+                          integral_type("577079379318451456178750531573524790977"
+                                        "27553907460720360838645569336604062198"),
+                          1)},
+        {"abcdef0123456789",
+         group_value_type(integral_type("844787039773145336861253730111765189180"
+                                        "69417287003338656136752748371997560378"),
+                          integral_type("308531760713997104583355136384995025900"
+                                        "48897055546040301024301883825591998504"),
+                          1)},
+        {"q128_"
+         "qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq"
+         "qqqqqqqqqqqqqqqqqqq",
+         group_value_type(integral_type("102262428709100978756793022659845432315"
+                                        "019126868557481312314604368156864057577"),
+                          integral_type("109572993580017857525517803897445772239"
+                                        "483468103890022576147795553142490650739"),
+                          1)},
+        {"a512_"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+         group_value_type(integral_type("103029844754233638164005859737962584871"
+                                        "386781778635321136935904547076618832280"),
+                          integral_type("598306228324054694689721902057383672322"
+                                        "49873093700477587008730083596009880230"),
+                          1)},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_pallas_h2c_sha256_test) {
+    // RFC 9380 has no vectors for this suite, these are generated by hash_to_curve_vectors.py
+    using curve_type = pallas;
+    using group_type = typename curve_type::g1_type<>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"",
+         group_value_type(integral_type("4002939958301323116492795096933969050258133803640671061281895022877905918603"),
+                          integral_type("228682923732983819224745623473247483557"
+                                        "81888260633754184893577164189916983622"),
+                          1)},
+        {"abc",
+         group_value_type(integral_type("240981665278859068461804906198121184138"
+                                        "49786001843221727655672376085930846833"),
+                          integral_type("468276367126329304023891759757627524497079410503291193270903742079630873623"),
+                          1)},
+        {"abcdef0123456789",
+         group_value_type(integral_type("117386667240759605558809234126240360106"
+                                        "19308489887174747216707127279355699145"),
+                          integral_type("219742568354271884198497610702076975805"
+                                        "59737431104907135892789167891750406164"),
+                          1)},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_vesta_h2c_sha256_test) {
+    // RFC 9380 has no vectors for this suite, these are generated by hash_to_curve_vectors.py
+    using curve_type = vesta;
+    using group_type = typename curve_type::g1_type<>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"",
+         group_value_type(integral_type("1748397945484132063096963288362882422829544099409361188227564652188453912973"),
+                          integral_type("109381243642232350102864390421470836855"
+                                        "34009011713458983132112945817284577830"),
+                          1)},
+        {"abc",
+         group_value_type(integral_type("261527335530509844775469582552754999589"
+                                        "33897943566291271232468936904486068843"),
+                          integral_type("7856349467404538192403684782106108972781232135311794139098675028493086288063"),
+                          1)},
+        {"abcdef0123456789",
+         group_value_type(integral_type("280518737708356546275142861514000002335"
+                                        "19077001867992577969727612773804684116"),
+                          integral_type("4963074871640298770281672231615854879108434764324887100176435497236999240821"),
+                          1)},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_alt_bn128_254_g1_h2c_sha256_test) {
+    // RFC 9380 has no vectors for this suite, these are generated by hash_to_curve_vectors.py
+    using curve_type = alt_bn128_254;
+    using group_type = typename curve_type::g1_type<>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"",
+         group_value_type(integral_type("4790658965958450548702669593570794336562317867247372723806336874591549759110"),
+                          integral_type("1163238807669877429342450210709044731909255047583162173012265677391336920021"),
+                          1)},
+        {"abc",
+         group_value_type(integral_type("162675248124666681662678837719924864383"
+                                        "38357688076900798565538061554532963281"),
+                          integral_type("1844916233815282837483764409618609279507070495361570126601873459268232811805"),
+                          1)},
+        {"abcdef0123456789",
+         group_value_type(integral_type("110776832439018089518592646836545867640"
+                                        "79462418577485658911541848692394044746"),
+                          integral_type("4858124309270455482359664916577923636817363175462672327824733704859450489677"),
+                          1)},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_alt_bn128_254_g2_h2c_sha256_test) {
+    // RFC 9380 has no vectors for this suite, these are generated by hash_to_curve_vectors.py
+    using curve_type = alt_bn128_254;
+    using group_type = typename curve_type::g2_type<>;
+    using h2c_type = ep2_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::value_type field_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"",
+         group_value_type(field_value_type(integral_type("79472805253555022882457670421394333326"
+                                                         "19084425813891508679326584140902765312"),
+                                           integral_type("105301415123488691419827133192070533431"
+                                                         "82583313484148698392330696376288318261")),
+                          field_value_type(integral_type("20795150288490572746493335611665514319"
+                                                         "56364880890028320215862191123161285080"),
+                                           integral_type("201691473230928700780287713452344451576"
+                                                         "17856249189458168875341276090072581620")),
+                          field_value_type::one())},
+        {"abc",
+         group_value_type(field_value_type(integral_type("103052137143125554195846852361646107660"
+                                                         "57227018997600762219755820581571775698"),
+                                           integral_type("51409989832737816455960430039966211709"
+                                                         "33075714207210952317183701750931672829")),
+                          field_value_type(integral_type("127826576102221028865069352653513987087"
+                                                         "99194735435757564502179253917869011884"),
+                                           integral_type("157464528507750915499663128218473362615"
+                                                         "90899319279618339578671846526379873840")),
+                          field_value_type::one())},
+        {"abcdef0123456789",
+         group_value_type(field_value_type(integral_type("91416495845682511334358116550828204522"
+                                                         "53999683001609355083509727807340928112"),
+                                           integral_type("192413373786207540080948154921624881018"
+                                                         "11979191715181531381201352430992486769")),
+                          field_value_type(integral_type("181492225143368850923569984915501868458"
+                                                         "22771992585824025266466238465484336696"),
+                                           integral_type("91293600978025253220558233744541701772"
+                                                         "67012396640126715240529872313988489338")),
+                          field_value_type::one())},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sqrt_ratio_bls12_381_test) {
+    check_sqrt_ratio<typename bls12_381::g1_type<>>();
+    check_sqrt_ratio<typename bls12_381::g2_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(clear_cofactor_bls12_381_test) {
+    using g1_type = typename bls12_381::g1_type<>;
+    using g2_type = typename bls12_381::g2_type<>;
+
+    check_clear_cofactor<ep_map<g1_type>, g1_type>();
+    check_clear_cofactor<ep2_map<g2_type>, g2_type>();
+}
+
+BOOST_AUTO_TEST_CASE(sqrt_ratio_secp256k1_pallas_test) {
+    check_sqrt_ratio<typename secp256k1::g1_type<>>();
+    check_sqrt_ratio<typename pallas::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(clear_cofactor_alt_bn128_254_test) {
+    using g2_type = typename alt_bn128_254::g2_type<>;
+
+    check_clear_cofactor<ep2_map<g2_type>, g2_type>();
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_batch_bls12_381_test) {
+    check_hash_to_curve_batch<ep_map<typename bls12_381::g1_type<>>>();
+    check_hash_to_curve_batch<ep2_map<typename bls12_381::g2_type<>>>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
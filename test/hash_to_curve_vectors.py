@@ -0,0 +1,506 @@
+#!/usr/bin/env python3
+#---------------------------------------------------------------------------#
+# MIT License
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#---------------------------------------------------------------------------#
+#
+# Generates the hash-to-curve test vectors of hash_to_curve.cpp for the suites
+# RFC 9380 has no vectors for:
+#
+#   pallas_XMD:SHA-256_SSWU_RO_, vesta_XMD:SHA-256_SSWU_RO_,
+#   BN254G1_XMD:SHA-256_SVDW_RO_, BN254G2_XMD:SHA-256_SVDW_RO_
+#
+# with the DST "QUUX-V01-CS02-with-" || suite id and the messages of RFC 9380 J.
+# It follows the RFC descriptions (5.3.1 expand_message_xmd, 5.2 hash_to_field,
+# 6.6.2 simplified SWU, 6.6.3 isogeny map, 6.6.1 Shallue-van de Woestijne,
+# 7 clear_cofactor) in affine coordinates with nothing but hashlib, so it
+# shares no arithmetic with the library.
+# secp256k1_XMD:SHA-256_SSWU_RO_ is included as a self-check against the RFC
+# vectors of J.8.1.
+#
+# The script is not part of the CMake build and ctest does not run it. Run it
+# by hand from the repository root with any Python 3, no packages needed:
+#
+#   python3 test/hash_to_curve_vectors.py
+#
+# It prints "suite | msg | x | y" per vector, coordinates in decimal, Fp2
+# elements as c0, c1, to be pasted into the test cases of hash_to_curve.cpp.
+# The secp256k1 lines have to match the vectors of RFC 9380 J.8.1.
+
+import hashlib
+
+# --------------------------------- fields ---------------------------------- #
+
+
+class Fp:
+    def __init__(self, v, p):
+        self.v, self.p = v % p, p
+
+    def lift(self, o):
+        return o.v if isinstance(o, Fp) else o
+
+    def __add__(self, o):
+        return Fp(self.v + self.lift(o), self.p)
+
+    __radd__ = __add__
+
+    def __sub__(self, o):
+        return Fp(self.v - self.lift(o), self.p)
+
+    def __rsub__(self, o):
+        return Fp(self.lift(o) - self.v, self.p)
+
+    def __mul__(self, o):
+        return Fp(self.v * self.lift(o), self.p)
+
+    __rmul__ = __mul__
+
+    def __neg__(self):
+        return Fp(-self.v, self.p)
+
+    def __eq__(self, o):
+        return self.v == self.lift(o) % self.p
+
+    def __pow__(self, e):
+        return Fp(pow(self.v, e, self.p), self.p)
+
+    def inv(self):
+        return Fp(pow(self.v, -1, self.p), self.p)
+
+    def __truediv__(self, o):
+        return self * (o if isinstance(o, Fp) else Fp(o, self.p)).inv()
+
+    def is_zero(self):
+        return self.v == 0
+
+    def is_square(self):
+        return self.v == 0 or pow(self.v, (self.p - 1) // 2, self.p) == 1
+
+    def sgn0(self):
+        return self.v & 1
+
+    def sqrt(self):
+        # Tonelli-Shanks
+        p, a = self.p, self.v
+        if a == 0:
+            return Fp(0, p)
+        q, e = p - 1, 0
+        while q % 2 == 0:
+            q, e = q // 2, e + 1
+        z = 2
+        while pow(z, (p - 1) // 2, p) != p - 1:
+            z += 1
+        m, c, t, r = e, pow(z, q, p), pow(a, q, p), pow(a, (q + 1) // 2, p)
+        while t != 1:
+            i, t2 = 1, t * t % p
+            while t2 != 1:
+                t2, i = t2 * t2 % p, i + 1
+            b = pow(c, 1 << (m - i - 1), p)
+            m, c, t, r = i, b * b % p, t * b * b % p, r * b % p
+        return Fp(r, p)
+
+    def one(self):
+        return Fp(1, self.p)
+
+    def zero(self):
+        return Fp(0, self.p)
+
+    def ints(self):
+        return [self.v]
+
+
+class Fp2:
+    """Fp[i] / (i^2 + 1)"""
+
+    def __init__(self, a, b, p):
+        self.a, self.b, self.p = a % p, b % p, p
+
+    def lift(self, o):
+        return o if isinstance(o, Fp2) else Fp2(o.v if isinstance(o, Fp) else o, 0, self.p)
+
+    def __add__(self, o):
+        o = self.lift(o)
+        return Fp2(self.a + o.a, self.b + o.b, self.p)
+
+    __radd__ = __add__
+
+    def __sub__(self, o):
+        o = self.lift(o)
+        return Fp2(self.a - o.a, self.b - o.b, self.p)
+
+    def __rsub__(self, o):
+        return self.lift(o) - self
+
+    def __mul__(self, o):
+        o = self.lift(o)
+        return Fp2(self.a * o.a - self.b * o.b, self.a * o.b + self.b * o.a, self.p)
+
+    __rmul__ = __mul__
+
+    def __neg__(self):
+        return Fp2(-self.a, -self.b, self.p)
+
+    def __eq__(self, o):
+        o = self.lift(o)
+        return self.a == o.a and self.b == o.b
+
+    def __pow__(self, e):
+        r, b = Fp2(1, 0, self.p), self
+        while e:
+            if e & 1:
+                r = r * b
+            b, e = b * b, e >> 1
+        return r
+
+    def norm(self):
+        return (self.a * self.a + self.b * self.b) % self.p
+
+    def inv(self):
+        n = pow(self.norm(), -1, self.p)
+        return Fp2(self.a * n, -self.b * n, self.p)
+
+    def __truediv__(self, o):
+        return self * self.lift(o).inv()
+
+    def conj(self):
+        return Fp2(self.a, -self.b, self.p)
+
+    def is_zero(self):
+        return self.a == 0 and self.b == 0
+
+    def is_square(self):
+        n = self.norm()
+        return n == 0 or pow(n, (self.p - 1) // 2, self.p) == 1
+
+    def sgn0(self):
+        return (self.a & 1) | ((self.a == 0) & (self.b & 1))
+
+    def sqrt(self):
+        # Tonelli-Shanks over p^2 - 1
+        if self.is_zero():
+            return self
+        p = self.p
+        q, e = p * p - 1, 0
+        while q % 2 == 0:
+            q, e = q // 2, e + 1
+        z = Fp2(1, 1, p)
+        while z.is_square():
+            z = z + 1
+        m, c, t, r = e, z**q, self**q, self ** ((q + 1) // 2)
+        while not t == 1:
+            i, t2 = 1, t * t
+            while not t2 == 1:
+                t2, i = t2 * t2, i + 1
+            b = c ** (1 << (m - i - 1))
+            m, c, t, r = i, b * b, t * b * b, r * b
+        return r
+
+    def one(self):
+        return Fp2(1, 0, self.p)
+
+    def zero(self):
+        return Fp2(0, 0, self.p)
+
+    def ints(self):
+        return [self.a, self.b]
+
+
+# ------------------------- curves y^2 = x^3 + Ax + B ----------------------- #
+
+
+def add(P, Q, A):
+    if P is None:
+        return Q
+    if Q is None:
+        return P
+    if P[0] == Q[0]:
+        if (P[1] + Q[1]).is_zero():
+            return None
+        slope = (P[0] * P[0] * 3 + A) / (P[1] * 2)
+    else:
+        slope = (Q[1] - P[1]) / (Q[0] - P[0])
+    x = slope * slope - P[0] - Q[0]
+    return (x, slope * (P[0] - x) - P[1])
+
+
+def mul(k, P, A):
+    R = None
+    while k:
+        if k & 1:
+            R = add(R, P, A)
+        P, k = add(P, P, A), k >> 1
+    return R
+
+
+def on_curve(P, A, B):
+    return P is None or P[1] * P[1] == P[0] * P[0] * P[0] + A * P[0] + B
+
+
+# ------------------------- RFC 9380 building blocks ------------------------ #
+
+
+def expand_message_xmd(msg, dst, len_in_bytes):
+    b_in_bytes, s_in_bytes = 32, 64
+    ell = (len_in_bytes + b_in_bytes - 1) // b_in_bytes
+    dst_prime = dst + bytes([len(dst)])
+    b0 = hashlib.sha256(bytes(s_in_bytes) + msg + len_in_bytes.to_bytes(2, "big") + b"\x00" + dst_prime).digest()
+    bi = hashlib.sha256(b0 + b"\x01" + dst_prime).digest()
+    uniform_bytes = bi
+    for i in range(2, ell + 1):
+        bi = hashlib.sha256(bytes(x ^ y for x, y in zip(b0, bi)) + bytes([i]) + dst_prime).digest()
+        uniform_bytes += bi
+    return uniform_bytes[:len_in_bytes]
+
+
+def hash_to_field(msg, dst, count, p, m, make):
+    L = 48    # ceil((ceil(log2(p)) + 128) / 8) for all the 254/255-bit fields here
+    uniform_bytes = expand_message_xmd(msg, dst, count * m * L)
+    return [
+        make([int.from_bytes(uniform_bytes[L * (j + i * m) : L * (j + i * m + 1)], "big") % p for j in range(m)])
+        for i in range(count)
+    ]
+
+
+def map_to_curve_simple_swu(u, A, B, Z):
+    one = u.one()
+    tv1 = Z * Z * u * u * u * u + Z * u * u
+    x1 = B / (Z * A) if tv1.is_zero() else (-B / A) * (one + tv1.inv())
+    gx1 = x1 * x1 * x1 + A * x1 + B
+    x2 = Z * u * u * x1
+    gx2 = x2 * x2 * x2 + A * x2 + B
+    x, y = (x1, gx1.sqrt()) if gx1.is_square() else (x2, gx2.sqrt())
+    if u.sgn0() != y.sgn0():
+        y = -y
+    return (x, y)
+
+
+def iso_map(P, k):
+    """k = (x_num, x_den, y_num, y_den) coefficients, lowest degree first, denominators monic"""
+    x, y = P
+
+    def horner(coeffs, monic):
+        r = x.zero()
+        for c in reversed(list(coeffs) + ([x.one()] if monic else [])):
+            r = r * x + c
+        return r
+
+    return (horner(k[0], False) / horner(k[1], True), y * horner(k[2], False) / horner(k[3], True))
+
+
+def svdw_constants(A, B, Z):
+    g = lambda x: x * x * x + A * x + B
+    c3 = (-(g(Z) * (3 * Z * Z + 4 * A))).sqrt()
+    if c3.sgn0():
+        c3 = -c3
+    return g(Z), -Z / 2, c3, -4 * g(Z) / (3 * Z * Z + 4 * A)
+
+
+def map_to_curve_svdw(u, A, B, Z):
+    c1, c2, c3, c4 = svdw_constants(A, B, Z)
+    g = lambda x: x * x * x + A * x + B
+    one = u.one()
+    tv1 = u * u * c1
+    tv2 = one + tv1
+    tv1 = one - tv1
+    tv3 = tv1 * tv2
+    tv3 = tv3 if tv3.is_zero() else tv3.inv()
+    tv4 = u * tv1 * tv3 * c3
+    x1, x2 = c2 - tv4, c2 + tv4
+    x3 = (tv2 * tv2 * tv3) ** 2 * c4 + Z
+    x = x1 if g(x1).is_square() else (x2 if g(x2).is_square() else x3)
+    y = g(x).sqrt()
+    if u.sgn0() != y.sgn0():
+        y = -y
+    return (x, y)
+
+
+# --------------------------------- suites ---------------------------------- #
+
+# y^2 = x^3 + A'x + B' isogenous to y^2 = x^3 + b, the isogeny coefficients are those of
+# curves/detail/h2c/h2c_iso_map.hpp; iso_suite checks that the map is a homomorphism onto the curve
+ISO_SUITES = {
+    "secp256k1_XMD:SHA-256_SSWU_RO_": dict(
+        p=2**256 - 2**32 - 977,
+        r=0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141,
+        b=7,
+        A=0x3F8731ABDD661ADCA08A5558F0F5D272E953D363CB6F0E5D405447C01A444533,
+        B=1771,
+        Z=-11,
+        k=(
+            [
+                0x8E38E38E38E38E38E38E38E38E38E38E38E38E38E38E38E38E38E38DAAAAA8C7,
+                0x07D3D4C80BC321D5B9F315CEA7FD44C5D595D2FC0BF63B92DFFF1044F17C6581,
+                0x534C328D23F234E6E2A413DECA25CAECE4506144037C40314ECBD0B53D9DD262,
+                0x8E38E38E38E38E38E38E38E38E38E38E38E38E38E38E38E38E38E38DAAAAA88C,
+            ],
+            [
+                0xD35771193D94918A9CA34CCBB7B640DD86CD409542F8487D9FE6B745781EB49B,
+                0xEDADC6F64383DC1DF7C4B2D51B54225406D36B641F5E41BBC52A56612A8C6D14,
+            ],
+            [
+                0x4BDA12F684BDA12F684BDA12F684BDA12F684BDA12F684BDA12F684B8E38E23C,
+                0xC75E0C32D5CB7C0FA9D0A54B12A0A6D5647AB046D686DA6FDFFC90FC201D71A3,
+                0x29A6194691F91A73715209EF6512E576722830A201BE2018A765E85A9ECEE931,
+                0x2F684BDA12F684BDA12F684BDA12F684BDA12F684BDA12F684BDA12F38E38D84,
+            ],
+            [
+                0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFF93B,
+                0x7A06534BB8BDB49FD5E9E6632722C2989467C1BFC8E8D978DFB425D2685C2573,
+                0x6484AA716545CA2CF3A70C3FA8FE337E0A3D21162F0D6299A7BF8192BFD2A76F,
+            ],
+        ),
+    ),
+    "pallas_XMD:SHA-256_SSWU_RO_": dict(
+        p=0x40000000000000000000000000000000224698FC094CF91B992D30ED00000001,
+        r=0x40000000000000000000000000000000224698FC0994A8DD8C46EB2100000001,
+        b=5,
+        A=0x18354A2EB0EA8C9C49BE2D7258370742B74134581A27A59F92BB4B0B657A014B,
+        B=1265,
+        Z=-13,
+        k=(
+            [
+                0x1C71C71C71C71C71C71C71C71C71C71C8102EEA8E7B06EB6EEBEC06955555580,
+                0x17329B9EC525375398C7D7AC3D98FD13380AF066CFEB6D690EB64FAEF37EA4F7,
+                0x3509AFD51872D88E267C7FFA51CF412A0F93B82EE4B994958CF863B02814FB76,
+                0x0E38E38E38E38E38E38E38E38E38E38E4081775473D8375B775F6034AAAAAAAB,
+            ],
+            [
+                0x325669BECAECD5D11D13BF2A7F22B105B4ABF9FB9A1FC81C2AA3AF1EAE5B6604,
+                0x1D572E7DDC099CFF5A607FCCE0494A799C434AC1C96B6980C47F2AB668BCD71F,
+            ],
+            [
+                0x025ED097B425ED097B425ED097B425ED0AC03E8E134EB3E493E53AB371C71C4F,
+                0x3FB98FF0D2DDCADD303216CCE1DB9FF11765E924F745937802E2BE87D225B234,
+                0x1A84D7EA8C396C47133E3FFD28E7A09507C9DC17725CCA4AC67C31D8140A7DBB,
+                0x1A12F684BDA12F684BDA12F684BDA12F7642B01AD461BAD25AD985B5E38E38E4,
+            ],
+            [
+                0x40000000000000000000000000000000224698FC094CF91B992D30ECFFFFFDE5,
+                0x17033D3C60C68173573B3D7F7D681310D976BBFABBC5661D4D90AB820B12320A,
+                0x0C02C5BCCA0E6B7F0790BFB3506DEFB65941A3A4A97AA1B35A28279B1D1B42AE,
+            ],
+        ),
+    ),
+    "vesta_XMD:SHA-256_SSWU_RO_": dict(
+        p=0x40000000000000000000000000000000224698FC0994A8DD8C46EB2100000001,
+        r=0x40000000000000000000000000000000224698FC094CF91B992D30ED00000001,
+        b=5,
+        A=0x267F9B2EE592271A81639C4D96F787739673928C7D01B212C515AD7242EAA6B1,
+        B=1265,
+        Z=-13,
+        k=(
+            [
+                0x31C71C71C71C71C71C71C71C71C71C71E1C521A795AC8356FB539A6F0000002B,
+                0x18760C7F7A9AD20DED7EE4A9CDF78F8FD59D03D23B39CB11AEAC67BBEB586A3D,
+                0x1D935247B4473D17ACECF10F5F7C09A2216B8861EC72BD5D8B95C6AAF703BCC5,
+                0x38E38E38E38E38E38E38E38E38E38E390205DD51CFA0961A43CD42C800000001,
+            ],
+            [
+                0x14735171EE5427780C621DE8B91C242A30CD6D53DF49D235F169C187D2533465,
+                0x0A2DE485568125D51454798A5B5C56B2A3AD678129B604D3B7284F7EAF21A2E9,
+            ],
+            [
+                0x1ED097B425ED097B425ED097B425ED098BC32D36FB21A6A38F64842C55555533,
+                0x19B0D87E16E2578866D1466E9DE10E6497A3CA5C24E9EA634986913AB4443034,
+                0x2EC9A923DA239E8BD6767887AFBE04D121D910AEFB03B31D8BEE58E5FB81DE63,
+                0x12F684BDA12F684BDA12F684BDA12F685601F4709A8ADCB36BEF1642AAAAAAAB,
+            ],
+            [
+                0x40000000000000000000000000000000224698FC0994A8DD8C46EB20FFFFFDE5,
+                0x3D59F455CAFC7668252659BA2B546C7E926847FB9DDD76A1D43D449776F99D2F,
+                0x2F44D6C801C1B8BF9E7EB64F890A820C06A767BFC35B5BAC58DFECCE86B2745E,
+            ],
+        ),
+    ),
+}
+
+BN254_P = 0x30644E72E131A029B85045B68181585D97816A916871CA8D3C208C16D87CFD47
+BN254_R = 0x30644E72E131A029B85045B68181585D2833E84879B9709143E1F593F0000001
+BN254_U = 4965661367192848881
+
+MESSAGES = ["", "abc", "abcdef0123456789", "q128_" + "q" * 128, "a512_" + "a" * 512]
+
+
+def dst(suite):
+    return b"QUUX-V01-CS02-with-" + suite.encode()
+
+
+def iso_suite(suite, msg):
+    s = ISO_SUITES[suite]
+    F = lambda v: Fp(v, s["p"])
+    A, B, Z = F(s["A"]), F(s["B"]), F(s["Z"])
+    k = [[F(c) for c in coeffs] for coeffs in s["k"]]
+
+    u = hash_to_field(msg.encode(), dst(suite), 2, s["p"], 1, lambda e: F(e[0]))
+    Q0 = map_to_curve_simple_swu(u[0], A, B, Z)
+    Q1 = map_to_curve_simple_swu(u[1], A, B, Z)
+    R = add(iso_map(Q0, k), iso_map(Q1, k), F(0))
+
+    assert on_curve(iso_map(Q0, k), F(0), F(s["b"])) and on_curve(iso_map(Q1, k), F(0), F(s["b"]))
+    assert iso_map(add(Q0, Q1, A), k) == R
+    assert mul(s["r"], R, F(0)) is None
+    return R
+
+
+def bn254_g1(msg):
+    suite = "BN254G1_XMD:SHA-256_SVDW_RO_"
+    F = lambda v: Fp(v, BN254_P)
+    A, B, Z = F(0), F(3), F(1)
+
+    u = hash_to_field(msg.encode(), dst(suite), 2, BN254_P, 1, lambda e: F(e[0]))
+    R = add(map_to_curve_svdw(u[0], A, B, Z), map_to_curve_svdw(u[1], A, B, Z), A)
+
+    assert on_curve(R, A, B) and mul(BN254_R, R, A) is None
+    return R
+
+
+def bn254_g2(msg):
+    suite = "BN254G2_XMD:SHA-256_SVDW_RO_"
+    F = lambda v: Fp2(v, 0, BN254_P)
+    xi = Fp2(9, 1, BN254_P)
+    A, B, Z = F(0), F(3) / xi, F(1)
+
+    u = hash_to_field(msg.encode(), dst(suite), 2, BN254_P, 2, lambda e: Fp2(e[0], e[1], BN254_P))
+    Q = add(map_to_curve_svdw(u[0], A, B, Z), map_to_curve_svdw(u[1], A, B, Z), A)
+
+    # psi = untwist-Frobenius-twist, clear_cofactor of Fuentes-Castaneda, Knapp, Rodriguez-Henriquez,
+    # "Faster hashing to G2": [x]Q + psi([3x]Q) + psi^2([x]Q) + psi^3(Q)
+    psi_x, psi_y = xi ** ((BN254_P - 1) // 3), xi ** ((BN254_P - 1) // 2)
+    psi = lambda P: None if P is None else (P[0].conj() * psi_x, P[1].conj() * psi_y)
+    x = BN254_U
+    R = add(add(mul(x, Q, A), psi(mul(3 * x, Q, A)), A), add(psi(psi(mul(x, Q, A))), psi(psi(psi(Q))), A), A)
+
+    assert on_curve(R, A, B) and mul(BN254_R, R, A) is None
+    return R
+
+
+if __name__ == "__main__":
+    generators = [(suite, lambda msg, suite=suite: iso_suite(suite, msg)) for suite in ISO_SUITES] + [
+        ("BN254G1_XMD:SHA-256_SVDW_RO_", bn254_g1),
+        ("BN254G2_XMD:SHA-256_SVDW_RO_", bn254_g2),
+    ]
+    for suite, generate in generators:
+        for msg in MESSAGES:
+            R = generate(msg)
+            print(
+                " | ".join(
+                    [suite, msg, ", ".join(str(c) for c in R[0].ints()), ", ".join(str(c) for c in R[1].ints())]
+                )
+            )
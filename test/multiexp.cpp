@@ -189,4 +189,160 @@ BOOST_AUTO_TEST_CASE(multiexp_test_case) {
     print_performance_csv<curves::bls12<381>::g2_type<>, curves::bls12<381>::scalar_field_type>(2, 20, 14, true);
 }
 
+BOOST_AUTO_TEST_CASE(multiexp_parallel_chunks_test_case) {
+    using group_type = curves::bls12<381>::g1_type<>;
+    using scalar_field_type = curves::bls12<381>::scalar_field_type;
+
+    std::vector<typename group_type::value_type> bases;
+    std::vector<typename scalar_field_type::value_type> scalars;
+    for (std::size_t i = 0; i < 67; ++i) {
+        bases.emplace_back(random_element<group_type>());
+        scalars.emplace_back(random_element<scalar_field_type>());
+    }
+
+    typename group_type::value_type expected = multiexp<policies::multiexp_method_naive_plain>(
+        bases.cbegin(), bases.cend(), scalars.cbegin(), scalars.cend(), 1);
+
+    for (std::size_t chunks_count : {2, 3, 8, 67}) {
+        BOOST_CHECK(multiexp<policies::multiexp_method_BDLO12>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                               scalars.cend(), chunks_count) == expected);
+        BOOST_CHECK(multiexp<policies::multiexp_method_BDLO12>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                               scalars.cend(), chunks_count,
+                                                               sequential_executor()) == expected);
+    }
+    BOOST_CHECK(multiexp<policies::multiexp_method_bos_coster>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                               scalars.cend()) == expected);
+}
+
+template<typename GroupType>
+void check_signed_batch_affine(std::size_t length) {
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+
+    std::vector<typename GroupType::value_type> bases;
+    std::vector<typename scalar_field_type::value_type> scalars;
+    for (std::size_t i = 0; i < length; ++i) {
+        bases.emplace_back(random_element<GroupType>());
+        scalars.emplace_back(random_element<scalar_field_type>());
+    }
+    if (length >= 8) {
+        // repeated, opposite and zero points, zero and minus one scalars
+        bases[1] = bases[0];
+        scalars[1] = scalars[0];
+        bases[3] = -bases[2];
+        scalars[3] = scalars[2];
+        bases[4] = bases[5].doubled();
+        bases[6] = GroupType::value_type::zero();
+        scalars[7] = scalar_field_type::value_type::zero();
+        scalars[5] = -scalar_field_type::value_type::one();
+    }
+
+    typename GroupType::value_type expected = multiexp<policies::multiexp_method_naive_plain>(
+        bases.cbegin(), bases.cend(), scalars.cbegin(), scalars.cend(), 1);
+
+    BOOST_CHECK(multiexp<policies::multiexp_method_signed_batch_affine>(bases.cbegin(), bases.cend(),
+                                                                        scalars.cbegin(), scalars.cend(),
+                                                                        1) == expected);
+    BOOST_CHECK(multiexp<policies::multiexp_method_signed_batch_affine>(bases.cbegin(), bases.cend(),
+                                                                        scalars.cbegin(), scalars.cend(),
+                                                                        4) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(multiexp_signed_batch_affine_test_case) {
+    for (std::size_t length : {1, 8, 31, 300}) {
+        check_signed_batch_affine<curves::bls12<381>::g1_type<>>(length);
+        check_signed_batch_affine<curves::mnt4<298>::g1_type<>>(length);
+    }
+    check_signed_batch_affine<curves::bls12<381>::g2_type<>>(100);
+
+    // same point everywhere: every window addition collides with its bucket
+    using group_type = curves::bls12<381>::g1_type<>;
+    using scalar_field_type = curves::bls12<381>::scalar_field_type;
+    std::vector<typename group_type::value_type> bases(100, random_element<group_type>());
+    std::vector<typename scalar_field_type::value_type> scalars;
+    for (std::size_t i = 0; i < bases.size(); ++i) {
+        scalars.emplace_back(random_element<scalar_field_type>());
+    }
+    BOOST_CHECK(multiexp<policies::multiexp_method_signed_batch_affine>(
+                    bases.cbegin(), bases.cend(), scalars.cbegin(), scalars.cend(), 1) ==
+                multiexp<policies::multiexp_method_naive_plain>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                                scalars.cend(), 1));
+}
+
+template<typename GroupType>
+void check_fixed_base_table(std::size_t window) {
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+    using value_type = typename GroupType::value_type;
+
+    const std::size_t scalar_size = scalar_field_type::modulus_bits;
+    const value_type g = random_element<GroupType>();
+
+    std::vector<typename scalar_field_type::value_type> scalars = {
+        scalar_field_type::value_type::zero(), scalar_field_type::value_type::one(),
+        -scalar_field_type::value_type::one(), typename scalar_field_type::value_type(1ul << (window - 1)),
+        typename scalar_field_type::value_type((1ul << (window - 1)) + 1)};
+    for (std::size_t i = 0; i < 20; ++i) {
+        scalars.emplace_back(random_element<scalar_field_type>());
+    }
+
+    window_table<GroupType> table = get_window_table<GroupType>(scalar_size, window, g);
+    BOOST_CHECK_EQUAL(table.size(), (scalar_size / window + 1) << (window - 1));
+
+    std::vector<value_type> expected;
+    for (const auto &s : scalars) {
+        expected.emplace_back(g * s);
+    }
+
+    BOOST_CHECK(batch_exp<GroupType, scalar_field_type>(scalar_size, window, table, scalars) == expected);
+    BOOST_CHECK(batch_exp<GroupType, scalar_field_type>(scalar_size, window, table, scalars, 3,
+                                                        sequential_executor()) == expected);
+
+    const typename scalar_field_type::value_type coeff = random_element<scalar_field_type>();
+    std::vector<value_type> res = batch_exp_with_coeff<GroupType, scalar_field_type>(scalar_size, window, table,
+                                                                                     coeff, scalars);
+    for (std::size_t i = 0; i < scalars.size(); ++i) {
+        BOOST_CHECK(res[i] == g * (coeff * scalars[i]));
+    }
+
+    // built in parallel slices
+    fixed_base_table<GroupType> sliced(scalar_size, window, g, 5, sequential_executor());
+    for (std::size_t i = 0; i < scalars.size(); ++i) {
+        BOOST_CHECK(sliced.exp(scalars[i]) == expected[i]);
+    }
+}
+
+template<typename GroupType>
+void check_fixed_base_table_bytes(std::size_t window) {
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+
+    const std::size_t scalar_size = scalar_field_type::modulus_bits;
+    fixed_base_table<GroupType> table(scalar_size, window, random_element<GroupType>());
+
+    std::vector<std::uint8_t> bytes(table.octets_num());
+    BOOST_CHECK(table.to_bytes(bytes.begin()) == bytes.end());
+
+    auto loaded = fixed_base_table<GroupType>::from_bytes(bytes.cbegin(), bytes.cend());
+    BOOST_CHECK(loaded.first);
+    BOOST_CHECK_EQUAL(loaded.second.size(), table.size());
+    for (std::size_t i = 0; i < 10; ++i) {
+        const typename scalar_field_type::value_type s = random_element<scalar_field_type>();
+        BOOST_CHECK(loaded.second.exp(s) == table.exp(s));
+    }
+
+    BOOST_CHECK(!fixed_base_table<GroupType>::from_bytes(bytes.cbegin(), bytes.cend() - 1).first);
+    bytes[0] ^= 1;
+    BOOST_CHECK(!fixed_base_table<GroupType>::from_bytes(bytes.cbegin(), bytes.cend()).first);
+}
+
+BOOST_AUTO_TEST_CASE(fixed_base_table_test_case) {
+    for (std::size_t window : {1, 4, 8}) {
+        check_fixed_base_table<curves::bls12<381>::g1_type<>>(window);
+    }
+    check_fixed_base_table<curves::bls12<381>::g2_type<>>(5);
+    check_fixed_base_table<curves::mnt4<298>::g1_type<>>(6);
+    check_fixed_base_table<curves::edwards<183>::g1_type<>>(4);
+
+    check_fixed_base_table_bytes<curves::bls12<381>::g1_type<>>(6);
+    check_fixed_base_table_bytes<curves::bls12<381>::g2_type<>>(4);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
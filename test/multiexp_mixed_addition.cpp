@@ -0,0 +1,119 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2022 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE multiexp_mixed_addition_test
+
+#define USE_MIXED_ADDITION
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/secp_r1.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename GroupType>
+void check_batch_to_special() {
+    using value_type = typename GroupType::value_type;
+    using field_value_type = typename GroupType::field_type::value_type;
+
+    std::vector<value_type> points;
+    for (std::size_t i = 0; i < 10; ++i) {
+        // doubling makes Z != 1
+        points.emplace_back(random_element<GroupType>().doubled());
+    }
+    points[3] = value_type::zero();
+    points.emplace_back(value_type::zero());
+
+    std::vector<value_type> special = points;
+    batch_to_special(special);
+
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        BOOST_CHECK(special[i] == points[i]);
+        BOOST_CHECK(special[i].is_zero() || special[i].Z == field_value_type::one());
+    }
+
+    // the formulas have to handle equal and opposite operands
+    BOOST_CHECK(points[0].mixed_add(special[0]) == points[0].doubled());
+    BOOST_CHECK((-points[0]).mixed_add(special[0]).is_zero());
+    BOOST_CHECK(points[0].mixed_add(special[1]) == points[0] + points[1]);
+}
+
+template<typename GroupType>
+void check_multiexp_mixed_addition(std::size_t length) {
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+
+    std::vector<typename GroupType::value_type> bases;
+    std::vector<typename scalar_field_type::value_type> scalars;
+    for (std::size_t i = 0; i < length; ++i) {
+        bases.emplace_back(random_element<GroupType>().doubled());
+        scalars.emplace_back(random_element<scalar_field_type>());
+    }
+    // repeated bases collide in the buckets, unit scalars take the mixed_add shortcut
+    bases[1] = bases[0];
+    scalars[1] = scalars[0];
+    scalars[2] = scalar_field_type::value_type::one();
+    scalars[3] = scalar_field_type::value_type::zero();
+    bases[4] = GroupType::value_type::zero();
+
+    typename GroupType::value_type expected = multiexp<policies::multiexp_method_naive_plain>(
+        bases.cbegin(), bases.cend(), scalars.cbegin(), scalars.cend(), 1);
+
+    batch_to_special(bases);
+
+    BOOST_CHECK(multiexp<policies::multiexp_method_BDLO12>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                           scalars.cend(), 1) == expected);
+    BOOST_CHECK(multiexp<policies::multiexp_method_BDLO12>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                           scalars.cend(), 3) == expected);
+    BOOST_CHECK(multiexp_with_mixed_addition<policies::multiexp_method_BDLO12>(
+                    bases.cbegin(), bases.cend(), scalars.cbegin(), scalars.cend(), 2) == expected);
+}
+
+BOOST_AUTO_TEST_SUITE(multiexp_mixed_addition_test_suite)
+
+BOOST_AUTO_TEST_CASE(batch_to_special_test_case) {
+    check_batch_to_special<curves::bls12<381>::g1_type<>>();
+    check_batch_to_special<curves::bls12<381>::g2_type<>>();
+    check_batch_to_special<curves::mnt4<298>::g1_type<>>();
+    check_batch_to_special<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian>>();
+    check_batch_to_special<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian_with_a4_minus_3>>();
+    check_batch_to_special<curves::secp_r1<256>::g1_type<curves::coordinates::projective_with_a4_minus_3>>();
+}
+
+BOOST_AUTO_TEST_CASE(multiexp_mixed_addition_test_case) {
+    check_multiexp_mixed_addition<curves::bls12<381>::g1_type<>>(100);
+    check_multiexp_mixed_addition<curves::bls12<381>::g2_type<>>(20);
+    check_multiexp_mixed_addition<curves::mnt4<298>::g1_type<>>(50);
+    check_multiexp_mixed_addition<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian>>(50);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
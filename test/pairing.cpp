@@ -27,27 +27,39 @@
 #define BOOST_TEST_MODULE algebra_curves_test
 
 #include <iostream>
+#include <string>
 #include <vector>
 #include <array>
+#include <utility>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/data/monomorphic.hpp>
 
+#include <boost/random/mersenne_twister.hpp>
+
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/wnaf.hpp>
 
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/edwards.hpp>
 #include <nil/crypto3/algebra/curves/mnt4.hpp>
 #include <nil/crypto3/algebra/curves/mnt6.hpp>
 
+#include <nil/crypto3/algebra/pairing/alt_bn128.hpp>
 #include <nil/crypto3/algebra/pairing/bls12.hpp>
 #include <nil/crypto3/algebra/pairing/mnt4.hpp>
 #include <nil/crypto3/algebra/pairing/mnt6.hpp>
 
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/algorithms/batch_verify_pairings.hpp>
+#include <nil/crypto3/algebra/pairing/precomputed_g2_cache.hpp>
+#include <nil/crypto3/algebra/pairing/detail/bls12/377/params.hpp>
+#include <nil/crypto3/algebra/pairing/detail/edwards/183/params.hpp>
 
 #include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/fp4.hpp>
@@ -516,6 +528,26 @@ void check_pairing_operations(std::vector<Fr_value_type> &Fr_elements,
                       double_miller_loop<CurveType>(G1_prec_elements[prec_A1], G2_prec_elements[prec_B1],
                                                    G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]));
     std::cout << " * Miller loop tests finished." << std::endl << std::endl;
+
+    std::cout << " * Multi Miller loop tests started..." << std::endl;
+    std::vector<std::pair<g1_precomp_value_type, g2_precomp_value_type>> prec_pairs;
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(prec_pairs), GT_value_type::one());
+    prec_pairs.emplace_back(G1_prec_elements[prec_A1], G2_prec_elements[prec_B1]);
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(prec_pairs), GT_elements[miller_loop_prec_A1_prec_B1]);
+    prec_pairs.emplace_back(G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]);
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(prec_pairs),
+                      GT_elements[double_miller_loop_prec_A1_prec_B1_prec_A2_prec_B2]);
+
+    prec_pairs.clear();
+    for (auto [g1, g2] : {std::make_pair(G1_elements[VKx], G2_elements[VKy]),
+                          std::make_pair(G1_elements[C1], G2_elements[VKz]),
+                          std::make_pair(G1_elements[VKx], G2_elements[VKy]),
+                          std::make_pair(G1_elements[C2], G2_elements[VKz])}) {
+        prec_pairs.emplace_back(precompute_g1<CurveType>(g1), precompute_g2<CurveType>(g2));
+    }
+    BOOST_CHECK_EQUAL(final_exponentiation<CurveType>(multi_miller_loop<CurveType>(prec_pairs)),
+                      GT_elements[pair_reduceding_A1_B1_mul_pair_reduceding_A2_B2]);
+    std::cout << " * Multi Miller loop tests finished." << std::endl << std::endl;
 }
 
 template<typename ElementType>
@@ -901,6 +933,70 @@ void pairing_operation_test(const TestSet &test_set) {
                                        G2_prec_elements);
 }
 
+template<typename ScheduleType, typename IntegralType>
+void check_miller_loop_schedule(const IntegralType &loop_count) {
+    BOOST_CHECK_EQUAL(ScheduleType::bits_count, msb(loop_count) + 1);
+    for (std::size_t i = 0; i < ScheduleType::binary.size(); ++i) {
+        BOOST_CHECK_EQUAL(ScheduleType::binary[i], bit_test(loop_count, ScheduleType::binary.size() - 1 - i));
+    }
+
+    const std::vector<long> naf = find_wnaf(1, loop_count);
+    std::size_t naf_length = naf.size();
+    while (naf_length > 0 && naf[naf_length - 1] == 0) {
+        --naf_length;
+    }
+    BOOST_CHECK_EQUAL(ScheduleType::naf_digits_count, naf_length);
+    for (std::size_t i = 0; i < ScheduleType::naf.size(); ++i) {
+        BOOST_CHECK_EQUAL(ScheduleType::naf[i], naf[ScheduleType::naf.size() - 1 - i]);
+    }
+}
+
+template<typename CurveType>
+void miller_loop_schedule_test() {
+    using params_type = pairing::detail::pairing_params<CurveType>;
+
+    check_miller_loop_schedule<typename params_type::ate_loop_schedule>(params_type::ate_loop_count);
+}
+
+/// Evaluates an input of the EIP-197 pairing precompile: 192-byte pairs of 32-byte big-endian words, the affine
+/// (x, y) of G1 followed by (x.c1, x.c0, y.c1, y.c0) of G2, where all-zero coordinates encode the point at infinity
+template<typename CurveType>
+bool eip197_pairing_check(const std::vector<std::string> &words) {
+    using policy_type = pairing_policy<CurveType>;
+    using g1_value_type = typename CurveType::template g1_type<>::value_type;
+    using g2_value_type = typename CurveType::template g2_type<>::value_type;
+    using g1_field_value_type = typename CurveType::base_field_type::value_type;
+    using g2_field_value_type = typename CurveType::template g2_type<>::field_type::value_type;
+    using integral_type = typename CurveType::base_field_type::integral_type;
+
+    BOOST_REQUIRE_EQUAL(words.size() % 6, 0);
+
+    std::vector<std::pair<typename policy_type::g1_precomputed_type, typename policy_type::g2_precomputed_type>>
+        prec_pairs;
+    for (std::size_t i = 0; i < words.size(); i += 6) {
+        const auto word = [&words, i](std::size_t j) { return integral_type("0x" + words[i + j]); };
+        const g1_field_value_type x1(word(0)), y1(word(1));
+        const g2_field_value_type x2(word(3), word(2)), y2(word(5), word(4));
+
+        const g1_value_type P = (x1.is_zero() && y1.is_zero()) ?
+                                    g1_value_type::zero() :
+                                    g1_value_type(x1, y1, g1_field_value_type::one());
+        const g2_value_type Q = (x2.is_zero() && y2.is_zero()) ?
+                                    g2_value_type::zero() :
+                                    g2_value_type(x2, y2, g2_field_value_type::one());
+        BOOST_REQUIRE(P.is_well_formed());
+        BOOST_REQUIRE(Q.is_well_formed());
+
+        // pairs with the point at infinity contribute a factor of one
+        if (!P.is_zero() && !Q.is_zero()) {
+            prec_pairs.emplace_back(precompute_g1<CurveType>(P), precompute_g2<CurveType>(Q));
+        }
+    }
+
+    return final_exponentiation<CurveType>(multi_miller_loop<CurveType>(prec_pairs)) ==
+           CurveType::gt_type::value_type::one();
+}
+
 BOOST_AUTO_TEST_SUITE(pairing_manual_tests)
 
 // TODO: fix pair_reduceding
@@ -921,4 +1017,268 @@ BOOST_DATA_TEST_CASE(pairing_operation_test_mnt6_298, string_data("pairing_opera
 
     pairing_operation_test<curve_type>(data_set);
 }
+
+BOOST_AUTO_TEST_CASE(miller_loop_schedule_test_case) {
+    miller_loop_schedule_test<curves::bls12<381>>();
+    miller_loop_schedule_test<curves::mnt4<298>>();
+    miller_loop_schedule_test<curves::mnt6<298>>();
+    miller_loop_schedule_test<curves::alt_bn128<254>>();
+    miller_loop_schedule_test<curves::bls12<377>>();
+    miller_loop_schedule_test<curves::edwards<183>>();
+
+    // the Tate Miller loop of edwards runs over the bits of the scalar field modulus
+    using edwards_params_type = pairing::detail::pairing_params<curves::edwards<183>>;
+    check_miller_loop_schedule<typename edwards_params_type::tate_loop_schedule>(
+        curves::edwards<183>::scalar_field_type::modulus);
+}
+
+BOOST_AUTO_TEST_CASE(pairing_bilinearity_test_alt_bn128) {
+    using curve_type = typename curves::alt_bn128<254>;
+    using policy_type = pairing_policy<curve_type>;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+
+    const g1_value_type P = g1_value_type::one();
+    const g2_value_type Q = g2_value_type::one();
+    const scalar_value_type a(5), b(7);
+
+    const gt_value_type e_PQ = pair_reduced<curve_type>(P, Q);
+    BOOST_CHECK(e_PQ != gt_value_type::one());
+    BOOST_CHECK_EQUAL(e_PQ.pow(cpp_int(curve_type::scalar_field_type::modulus)), gt_value_type::one());
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(a * P, b * Q), e_PQ.pow(cpp_int(35)));
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(a * P, b * Q), pair_reduced<curve_type>((a * b) * P, Q));
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(P, Q + Q), e_PQ.squared());
+
+    const typename policy_type::g2_precomputed_type prec_Q = precompute_g2<curve_type>(b * Q);
+    BOOST_CHECK_EQUAL(prec_Q.coeffs.size(), policy_type::precomputed_g2_marshalling::coeffs_count());
+    BOOST_CHECK_EQUAL(double_miller_loop<curve_type>(precompute_g1<curve_type>(a * P), prec_Q,
+                                                     precompute_g1<curve_type>(P), precompute_g2<curve_type>(Q)),
+                      miller_loop<curve_type>(precompute_g1<curve_type>(a * P), prec_Q) *
+                          miller_loop<curve_type>(precompute_g1<curve_type>(P), precompute_g2<curve_type>(Q)));
+
+    // e(aP, bQ) * e(-abP, Q) == 1, as checked by the pairing precompile of Ethereum
+    std::vector<std::pair<typename policy_type::g1_precomputed_type, typename policy_type::g2_precomputed_type>>
+        prec_pairs;
+    prec_pairs.emplace_back(precompute_g1<curve_type>(a * P), prec_Q);
+    prec_pairs.emplace_back(precompute_g1<curve_type>(-((a * b) * P)), precompute_g2<curve_type>(Q));
+    BOOST_CHECK_EQUAL(final_exponentiation<curve_type>(multi_miller_loop<curve_type>(prec_pairs)),
+                      gt_value_type::one());
+    prec_pairs.back().first = precompute_g1<curve_type>(-(a * P));
+    BOOST_CHECK(final_exponentiation<curve_type>(multi_miller_loop<curve_type>(prec_pairs)) != gt_value_type::one());
+}
+
+BOOST_AUTO_TEST_CASE(pairing_known_answer_test_alt_bn128) {
+    using curve_type = typename curves::alt_bn128<254>;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+    using fp6 = typename gt_value_type::underlying_type;
+    using fp2 = typename fp6::underlying_type;
+    using integral_type = typename curve_type::base_field_type::integral_type;
+
+    // e(G1, G2) as computed by libff: the final exponentiation raises to 2z(6z^2 + 3z + 1) * (p^12 - 1) / r, so this
+    // is the optimal ate pairing of py_ecc 8.0.0 (optimized_bn128) raised to 2z(6z^2 + 3z + 1), z = 4965661367192848881
+    const gt_value_type expected(
+        fp6(fp2(integral_type("17264119758069723980713015158403419364912226240334615592005620718956030922389"),
+                integral_type("1300711225518851207585954685848229181392358478699795190245709208408267917898")),
+            fp2(integral_type("8894217292938489450175280157304813535227569267786222825147475294561798790624"),
+                integral_type("1829859855596098509359522796979920150769875799037311140071969971193843357227")),
+            fp2(integral_type("4968700049505451466697923764727215585075098085662966862137174841375779106779"),
+                integral_type("12814315002058128940449527172080950701976819591738376253772993495204862218736"))),
+        fp6(fp2(integral_type("4233474252585134102088637248223601499779641130562251948384759786370563844606"),
+                integral_type("9420544134055737381096389798327244442442230840902787283326002357297404128074")),
+            fp2(integral_type("13457906610892676317612909831857663099224588803620954529514857102808143524905"),
+                integral_type("5122435115068592725432309312491733755581898052459744089947319066829791570839")),
+            fp2(integral_type("8891987925005301465158626530377582234132838601606565363865129986128301774627"),
+                integral_type("440796048150724096437130979851431985500142692666486515369083499585648077975"))));
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(g1_value_type::one(), g2_value_type::one()), expected);
+}
+
+BOOST_AUTO_TEST_CASE(pairing_eip197_test_alt_bn128) {
+    using curve_type = typename curves::alt_bn128<254>;
+
+    // inputs in the encoding of the EIP-197 pairing precompile, generated with py_ecc 8.0.0 (optimized_bn128)
+
+    // the empty input
+    BOOST_CHECK(eip197_pairing_check<curve_type>({}));
+
+    // e(G1, G2) != 1
+    BOOST_CHECK(!eip197_pairing_check<curve_type>({
+        "0000000000000000000000000000000000000000000000000000000000000001",
+        "0000000000000000000000000000000000000000000000000000000000000002",
+        "198e9393920d483a7260bfb731fb5d25f1aa493335a9e71297e485b7aef312c2",
+        "1800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed",
+        "090689d0585ff075ec9e99ad690c3395bc4b313370b38ef355acdadcd122975b",
+        "12c85ea5db8c6deb4aab71808dcb408fe3d1e7690c43d37b4ce6cc0166fa7daa"}));
+
+    // e(G1, G2) * e(-G1, G2) == 1
+    BOOST_CHECK(eip197_pairing_check<curve_type>({
+        "0000000000000000000000000000000000000000000000000000000000000001",
+        "0000000000000000000000000000000000000000000000000000000000000002",
+        "198e9393920d483a7260bfb731fb5d25f1aa493335a9e71297e485b7aef312c2",
+        "1800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed",
+        "090689d0585ff075ec9e99ad690c3395bc4b313370b38ef355acdadcd122975b",
+        "12c85ea5db8c6deb4aab71808dcb408fe3d1e7690c43d37b4ce6cc0166fa7daa",
+        "0000000000000000000000000000000000000000000000000000000000000001",
+        "30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd45",
+        "198e9393920d483a7260bfb731fb5d25f1aa493335a9e71297e485b7aef312c2",
+        "1800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed",
+        "090689d0585ff075ec9e99ad690c3395bc4b313370b38ef355acdadcd122975b",
+        "12c85ea5db8c6deb4aab71808dcb408fe3d1e7690c43d37b4ce6cc0166fa7daa"}));
+
+    // e(aG1, bG2) * e(cG1, dG2) == 1 with ab + cd == 0 mod r
+    BOOST_CHECK(eip197_pairing_check<curve_type>({
+        "118c7a14188755cb285f38c9a3416340925c49b322fecd8ac879256bfd25d4f8",
+        "1c4f00185ffac2a999df2683fa5a886a964d908c95488b3f76f574f7fb3b77ed",
+        "2ffcab8638d3fa85bfd64350cf8ccfc47b3e79ff4cf3955080b57ffa14d13ae4",
+        "2dba22f273ae488cca6451a36601183a50d36bff86eaa488743ab2fdfbd427bc",
+        "17ba3db9cf1944ebc55c322ffc563331e30447da26ffe3a8c0029e501278c462",
+        "076ee51d506056fab36cbffb9ab7cb36d5be2c57aa743d36a607a9a829985808",
+        "30536e4b17c82ce8b3d715ec96a51c9656b8e8d600b390841bd970f733111abb",
+        "181d5146e2d381f1920f20a50da194ba693646024d565351619d2b3f02450dc1",
+        "1bcf42a40a35031aed401608b79def28134d212df0bde2bf2278a141d4beca47",
+        "14bc8a64410468002f09068644e03cbb2f3f0efb2606a8b2b9ea13129955ed76",
+        "06f9badc710015480b420339cc31c90eeb708e18451699adae2fda188d636e28",
+        "21ca4ef099695b655a17806129ea618bd3383f6073644d36b7465315562649ca"}));
+
+    // the same with d + 1
+    BOOST_CHECK(!eip197_pairing_check<curve_type>({
+        "118c7a14188755cb285f38c9a3416340925c49b322fecd8ac879256bfd25d4f8",
+        "1c4f00185ffac2a999df2683fa5a886a964d908c95488b3f76f574f7fb3b77ed",
+        "2ffcab8638d3fa85bfd64350cf8ccfc47b3e79ff4cf3955080b57ffa14d13ae4",
+        "2dba22f273ae488cca6451a36601183a50d36bff86eaa488743ab2fdfbd427bc",
+        "17ba3db9cf1944ebc55c322ffc563331e30447da26ffe3a8c0029e501278c462",
+        "076ee51d506056fab36cbffb9ab7cb36d5be2c57aa743d36a607a9a829985808",
+        "30536e4b17c82ce8b3d715ec96a51c9656b8e8d600b390841bd970f733111abb",
+        "181d5146e2d381f1920f20a50da194ba693646024d565351619d2b3f02450dc1",
+        "25ff6dddbaf0de8b71fa30bb101f2ad974d0c7cfe888bbafcf017401409dad23",
+        "20b61e84bf6f222efe80b623c4d02b29847fe4840aad6883a0b811617f10ef27",
+        "2d7f8a81f1a415399d870dc299f1932261a63614637c8bdf754b66fc8d77d174",
+        "24f8d3fbbe0d4f38f68bfaa4e2ad179b4bfed97d3a08752e93f9178286e88b0f"}));
+
+    // a pair with the point at infinity is skipped
+    BOOST_CHECK(eip197_pairing_check<curve_type>({
+        "0000000000000000000000000000000000000000000000000000000000000000",
+        "0000000000000000000000000000000000000000000000000000000000000000",
+        "198e9393920d483a7260bfb731fb5d25f1aa493335a9e71297e485b7aef312c2",
+        "1800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed",
+        "090689d0585ff075ec9e99ad690c3395bc4b313370b38ef355acdadcd122975b",
+        "12c85ea5db8c6deb4aab71808dcb408fe3d1e7690c43d37b4ce6cc0166fa7daa",
+        "0000000000000000000000000000000000000000000000000000000000000001",
+        "0000000000000000000000000000000000000000000000000000000000000002",
+        "198e9393920d483a7260bfb731fb5d25f1aa493335a9e71297e485b7aef312c2",
+        "1800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed",
+        "090689d0585ff075ec9e99ad690c3395bc4b313370b38ef355acdadcd122975b",
+        "12c85ea5db8c6deb4aab71808dcb408fe3d1e7690c43d37b4ce6cc0166fa7daa",
+        "0000000000000000000000000000000000000000000000000000000000000001",
+        "30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd45",
+        "198e9393920d483a7260bfb731fb5d25f1aa493335a9e71297e485b7aef312c2",
+        "1800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed",
+        "090689d0585ff075ec9e99ad690c3395bc4b313370b38ef355acdadcd122975b",
+        "12c85ea5db8c6deb4aab71808dcb408fe3d1e7690c43d37b4ce6cc0166fa7daa"}));
+}
+
+BOOST_AUTO_TEST_CASE(batch_verify_pairings_test_bls12_381) {
+    using curve_type = typename curves::bls12<381>;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+
+    std::vector<pairing_equation<curve_type>> equations;
+    for (std::size_t i = 1; i <= 5; ++i) {
+        const scalar_value_type x(i + 2), y(3 * i + 1);
+        equations.push_back({x * g1_value_type::one(), y * g2_value_type::one(), g1_value_type::one(),
+                             (x * y) * g2_value_type::one()});
+    }
+    boost::random::mt19937 rng(1);
+
+    BOOST_CHECK(batch_verify_pairings<curve_type>(equations, rng));
+    BOOST_CHECK(batch_verify_pairings<curve_type>(equations, rng, 2, sequential_executor()));
+    BOOST_CHECK(batch_find_failed_pairings<curve_type>(equations, rng).empty());
+    BOOST_CHECK(batch_verify_pairings<curve_type>(std::vector<pairing_equation<curve_type>>(), rng));
+
+    equations[1].a = equations[1].a + g1_value_type::one();
+    equations[4].d = equations[4].d.doubled();
+    BOOST_CHECK(!batch_verify_pairings<curve_type>(equations, rng));
+    BOOST_CHECK(batch_find_failed_pairings<curve_type>(equations, rng, 3, sequential_executor()) ==
+                std::vector<std::size_t>({1, 4}));
+}
+
+BOOST_AUTO_TEST_CASE(precomputed_g2_cache_test_bls12_381) {
+    using curve_type = typename curves::bls12<381>;
+    using policy_type = pairing_policy<curve_type>;
+    using marshalling_type = typename policy_type::precomputed_g2_marshalling;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+
+    std::vector<g2_value_type> points;
+    for (std::size_t i = 1; i <= 4; ++i) {
+        points.push_back(scalar_value_type(i * i + 1) * g2_value_type::one());
+    }
+    const g1_value_type P = scalar_value_type(7) * g1_value_type::one();
+
+    // byte format
+    const typename policy_type::g2_precomputed_type prec_Q = precompute_g2<curve_type>(points[0]);
+    BOOST_CHECK_EQUAL(prec_Q.coeffs.size(), marshalling_type::coeffs_count());
+    BOOST_CHECK_EQUAL(prec_Q.coeffs.capacity(), marshalling_type::coeffs_count());
+    BOOST_CHECK_EQUAL(alignof(typename policy_type::g2_precomputed_type) %
+                          pairing::detail::precomputed_coeffs_alignment,
+                      0);
+    std::vector<std::uint8_t> octets(marshalling_type::octets_num());
+    BOOST_CHECK(marshalling_type::to_bytes(prec_Q, octets.begin()) == octets.end());
+    auto restored = marshalling_type::from_bytes(octets.begin(), octets.end());
+    BOOST_CHECK(restored.first);
+    BOOST_CHECK_EQUAL(restored.second, prec_Q);
+    BOOST_CHECK(!marshalling_type::from_bytes(octets.begin(), octets.end() - 1).first);
+    std::fill(octets.begin(), octets.begin() + marshalling_type::fp_octets_num, 0xFF);
+    BOOST_CHECK(!marshalling_type::from_bytes(octets.begin(), octets.end()).first);
+
+    // store layout, the last point is left out
+    using store_view_type = precomputed_g2_store_view<curve_type>;
+    const std::vector<std::uint8_t> store_octets =
+        store_view_type::build(std::vector<g2_value_type>(points.begin(), points.end() - 1));
+    BOOST_CHECK_EQUAL(store_octets.size(), store_view_type::octets_num(points.size() - 1));
+    const store_view_type store(store_octets.data(), store_octets.size());
+    BOOST_CHECK_EQUAL(store.size(), points.size() - 1);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        auto stored = store.find(store_view_type::key(points[i]));
+        BOOST_CHECK_EQUAL(stored.first, i + 1 < points.size());
+        if (stored.first) {
+            BOOST_CHECK_EQUAL(stored.second, precompute_g2<curve_type>(points[i]));
+        }
+    }
+    BOOST_CHECK(store_view_type(store_octets.data(), store_octets.size() - 1).empty());
+
+    // a record holding the precomputation of another point is a miss
+    const std::size_t record_octets_num = store_view_type::record_octets_num(),
+                      key_octets_num = std::tuple_size<typename store_view_type::key_type>::value,
+                      first_record = store_view_type::octets_num(0);
+    std::vector<std::uint8_t> mismatched_octets = store_octets;
+    std::copy(store_octets.begin() + first_record + record_octets_num + key_octets_num,
+              store_octets.begin() + first_record + 2 * record_octets_num,
+              mismatched_octets.begin() + first_record + key_octets_num);
+    const store_view_type mismatched_store(mismatched_octets.data(), mismatched_octets.size());
+    std::size_t found_count = 0;
+    for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+        found_count += mismatched_store.find(store_view_type::key(points[i])).first;
+    }
+    BOOST_CHECK_EQUAL(found_count, points.size() - 2);
+
+    // LRU cache over the store
+    precomputed_g2_cache<curve_type> cache(2, &store);
+    auto prec_Q0 = cache.get(points[0]);
+    BOOST_CHECK(cache.get(points[0]) == prec_Q0);
+    BOOST_CHECK_EQUAL(miller_loop<curve_type>(precompute_g1<curve_type>(P), *prec_Q0),
+                      miller_loop<curve_type>(precompute_g1<curve_type>(P), precompute_g2<curve_type>(points[0])));
+    cache.get(points[1]);
+    cache.get(points[0]);
+    BOOST_CHECK_EQUAL(*cache.get(points[3]), precompute_g2<curve_type>(points[3]));
+    BOOST_CHECK_EQUAL(cache.size(), 2u);
+    BOOST_CHECK(cache.contains(points[0]));
+    BOOST_CHECK(!cache.contains(points[1]));
+    BOOST_CHECK(cache.contains(points[3]));
+}
 BOOST_AUTO_TEST_SUITE_END()